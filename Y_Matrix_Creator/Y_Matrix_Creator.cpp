@@ -1,9 +1,24 @@
 ﻿#include<iostream>
 #include<iomanip>
-#include<fstream>
 #include<string>
+#include<cstdlib>
 #include<vector>
-
+#include<chrono>
+#include<cstdio>
+#include<cstring>
+#include<memory>
+
+#include "y_matrix.hpp"
+#include "io.hpp"
+#include "binary_format.hpp"
+#include "sparse_lu.hpp"
+#include "spmv.hpp"
+#include "analysis.hpp"
+#include "bench.hpp"
+#include "stream.hpp"
+#include "variants.hpp"
+#include "scenarios.hpp"
+#include "server.hpp"
 
 /* Y_Matrix.c
 *
@@ -11,402 +26,792 @@
 * 
 * 저장 공간을 최대한 줄이기 위해, 모든 배열이 아닌 사용되는 배열의 위치와 값만을 저장하였다.
 * 또한, 명령어 실행 중 해당 위치의 어드미턴스 값이 0이 된 경우, 해당 값이 저장되어 있던 공간을 제거하도록 하였다.
+* 저장된 값의 위치는 (node1, node2)를 key로 하는 Open Addressing Hash Table로 찾아, 계통의 크기와 관계없이 일정한 시간에 접근한다.
+* 선로 수가 많은 경우, 여러 thread가 선로를 나누어 계산한 뒤 정렬과 합산으로 Y-Matrix를 구성할 수 있다. (--threads 옵션)
+* 선로의 어드미턴스는 여러 선로를 묶어 한 번씩만 계산하며, CPU가 지원하는 경우 double, float 값은 AVX2 또는 AVX-512 명령어로 계산한다.
+* 구성이 끝난 Y-Matrix는 freeze() 함수로 CSR(Compressed Sparse Row) 형태로 변환하여, 행 순서대로 읽는다.
+* Y_Matrix는 실수 형식과 node 번호의 정수 형식을 template 인수로 받으며, 값을 node1, node2, G, jB 배열로 나누어 저장한다. (--precision 옵션)
+* getMatrix() 함수는 값을 std::complex로 반환하거나 주어진 공간에 저장하며, 여러 thread에서 잠금 없이 동시에 읽을 수 있다.
+* 출력은 전체 행렬(dense) 외에, 0이 아닌 값만을 MatrixMarket 형식 또는 CSV 형식으로 출력할 수 있다. (--format 옵션)
+* 출력 전에 행과 열을 Reverse Cuthill-McKee 순서로 바꾸어, 0이 아닌 값을 대각선 근처로 모을 수 있다. (--reorder 옵션)
+* 입력 파일의 node 번호는 읽으면서 0부터 N-1까지의 번호에 대응시켜, 번호가 크고 띄엄띄엄한 경우에도 실제 node의 수만큼만 출력한다.
+* 구성된 Y-Matrix를 희소 행렬 LU 분해하여, 주어진 전류 주입에 대한 각 node의 전압(Y V = I)을 구할 수 있다. (--solve 옵션)
+* 또한, 모선 정보를 주면 Newton-Raphson 방식의 전력 조류 계산을 한다. (--powerflow 옵션)
+* 구성된 Y-Matrix에 여러 전압을 곱하여(I = Y V) 각 node의 전류를 구할 수 있다. (--multiply, --bench-spmv 옵션)
+* Z-bus(Y^(-1))에서 고장 node의 열만을 희소 행렬 대입으로 구하여, 3상 단락 고장 전류와 고장 후 전압을 계산한다. (--fault 옵션)
+* 주어진 node만 남기고 나머지 node를 희소 Gauss 소거하여, Kron 축약한 Y-Matrix를 같은 형식으로 출력할 수 있다. (--kron 옵션)
+* 기본 계통을 한 번 분해한 뒤, 각 선로가 하나씩 빠지는 상정 사고(N-1)를 저차수 갱신(Woodbury 공식)으로 계산한다. (--contingency 옵션)
+* 구조가 같고 선로의 값만 다른 여러 시나리오의 Y-Matrix를, 구조를 한 번만 구한 뒤 여러 thread로 값만 계산하여 구성한다. (--scenarios 옵션)
+* 하나의 기본 계통을 공유하고 차이만을 저장하는 변형 계통(what-if)을 여러 개 만들어, 달라진 값을 읽거나 전체 Y-Matrix를 만들 수 있다. (--variants 옵션)
+* 변경 기록(+/- 선로, ~ 변압기 tap)을 표준 입력이나 pipe에서 계속 읽어 구성된 Y-Matrix에 바로 더하거나 빼고, 묶음마다 바뀐 값만을 출력한다. (--stream 옵션)
+* Linux에서는 계통을 한 번 읽어 memory에 두고, Unix domain socket과 epoll event loop로 여러 client의 요청에 응답할 수 있다. (--serve 옵션)
+* 입력 파일에는 선로 외에 tap 비와 위상 변위를 가진 변압기(T)와 병렬 소자(S)를 줄 수 있으며, 위상 변위로 달라지는 하삼각 값은 상삼각 값과의 차이만 따로 저장한다.
+* 선로 정보와 구성된 Y-Matrix는 Binary 파일로 저장할 수 있으며(--save-bin 옵션), Binary 파일을 입력으로 주면 Y-Matrix 구성 없이 바로 읽는다.
+* 
+* 실행 시, 입력 파일을 인수로 받아, 이를 해석한다. 입력 파일은 memory-mapped file로 열어, 복사 없이 std::from_chars로 읽는다.
+* --stats 옵션을 주면, 주요 함수의 호출 횟수와 단계별 걸린 시간을 JSON 형식으로 출력한다. (Y_MATRIX_STATS=0으로 compile하면 기록하는 부분이 사라진다.)
+* --bench 옵션을 주면, 입력 파일 대신 임의의 계통을 생성하여 Y-Matrix 구성 시간을 측정한다.
+* --generate 옵션으로 radial, mesh, random 형태의 임의의 계통을 입력 파일 양식으로 생성할 수 있으며,
+* --bench-suite 옵션은 이 계통들의 선로 수를 늘려가며 읽기, 구성, 값 읽기, 출력 시간을 각각 측정하여 CSV 형식으로 출력한다.
 * 
-* 실행 시, 입력 파일을 인수로 받아, 이를 해석한다.
+* 기능별로 파일을 나누어, 이 파일에는 명령 인수 해석(main)과 buildMatrix()만을 두고, 나머지는 y_matrix_core library로 compile한다. (CMakeLists.txt)
+* y_matrix.hpp(Y_Matrix, Y_Matrix_CSR, 어드미턴스 계산), stats.hpp(실행 통계), io.hpp(입력 해석, 출력 형식, 순서 변경), binary_format.hpp(Binary 파일),
+* sparse_lu.hpp(LU 분해), spmv.hpp(Y-Matrix와 전압의 곱), analysis.hpp(전압, 전력 조류, 상정 사고, Kron 축약, 고장 계산),
+* bench.hpp(계통 생성, 성능 측정), stream.hpp(변경 기록), variants.hpp(변형 계통), scenarios.hpp(시나리오), server.hpp(Linux server)
 * 
 * 작성자: YHC03
-* 최종 수정일: 2024/10/06
-*/
-
-
-/* Y_Matrix_Val 구조체
- *
- * 인수: node1, node2(연결된 Node), G, jB(어드미턴스의 실수값과 허수값)
- * 최종 수정일: 2024/10/05
-*/
-typedef struct
-{
-    long long int node1, node2;
-    long double G, jB;
-}Y_Matrix_Val;
-
-/* RealValCalc() 함수
-*
-* 기능: 주어진 저항성분 R+jX에 대한 어드미턴스 실수부를 구한다.
-* 입력값: R, X
-* 출력값: 어드미턴스 실수부
-* 최종 수정일: 2024/10/05
+* 최종 수정일: 2026/10/17
 */
-inline long double RealValCalc(long double R, long double X)
-{
-    return R / (R * R + X * X);
-}
 
-/* ImagValCalc() 함수
+/* buildMatrix() 함수
 *
-* 기능: 주어진 저항성분 R+jX에 대한 어드미턴스 허수부를 구한다.
-* 입력값: R, X
-* 출력값: 어드미턴스 허수부
-* 최종 수정일: 2024/10/05
+* 기능: 선로 정보로 Y_Matrix<T, IndexT>를 구성하고, 행 순서대로 읽기 위해 CSR 형태로 변환한다.
+*       여러 thread를 사용하는 경우, 선로를 나누어 구성한다. 변압기와 병렬 소자는 선로를 모두 더한 뒤 차례대로 더한다.
+* 입력값: branch, device, threadCount, isDeterministic
+* 출력값: CSR 형태의 Y-Matrix
+* 최종 수정일: 2026/10/17
 */
-inline long double ImagValCalc(long double R, long double X)
+template <typename T, typename IndexT>
+Y_Matrix_CSR buildMatrix(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, int threadCount, bool isDeterministic)
 {
-    return (-1) * X / (R * R + X * X);
-}
-
-/* Y_Matrix 클래스
-* 
-* 기능: 특정 전력계통의 Y_Matrix값을 저장한다.
-* 최종 수정일: 2024/10/05
-*/
-class Y_Matrix{
-private:
-    // Y-Matrix의 0이 아닌 값을 저장하는 vector
-    std::vector<Y_Matrix_Val> lineValue;
-
-    long long int findMatrix(long long int Node1, long long int Node2);
-
-
-    bool isValueEmpty(long long int cursor);
-
-public:
-Y_Matrix();
-~Y_Matrix();
-
-void addMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C);
-
-void subtractMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C);
+    Y_Matrix<T, IndexT> yMatrix;
 
-void addMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C);
-
-void subtractMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C);
-
-long double* getMatrix(long long int Node1, long long int Node2);
+    STATS_PHASE_BEGIN(PHASE_ASSEMBLY);
+    if (threadCount > 1)
+    {
+        yMatrix.addMatrixParallel(branch, threadCount, isDeterministic);
+    }else{
+        yMatrix.addBranches(branch);
+    }
+    yMatrix.addDevices(device);
+    STATS_PHASE_END(PHASE_ASSEMBLY);
 
-};
+    STATS_PHASE_BEGIN(PHASE_FREEZE);
+    Y_Matrix_CSR matrixCSR = yMatrix.freeze();
+    STATS_PHASE_END(PHASE_FREEZE);
 
-/* Y_Matrix의 생성자
- *
- * 특별한 기능 없음
- * 최종 수정일: 2024/10/05
-*/
-Y_Matrix::Y_Matrix()
-{
-    return;
+    return matrixCSR;
 }
 
-/* Y_Matrix의 소멸자
-* 
-* 기능: lineValue Vector 초기화
-* 최종 수정일: 2024/10/05
+/*
+* main() 함수
+* 기능: File을 읽고, Y-Matrix을 계산해 출력한다.
+* 입력값: file 인수
+*         --bench: Y-Matrix 구성 시간 측정
+*         --format=dense|mtx|csv: 출력 형식(전체 행렬, MatrixMarket, CSV), 기본값은 dense
+*         --output=(파일): 결과를 저장할 파일, 기본값은 표준 출력
+*         --save-bin=(파일): 선로 정보와 Y-Matrix를 Binary 파일로 저장
+*         --threads=(수): Y-Matrix 구성에 사용할 thread 수, 기본값은 1
+*         --deterministic: 여러 thread를 사용하는 경우에도, 1개의 thread로 구성한 결과와 bit 단위로 같은 결과를 얻는다.
+*         --solve=(파일): 주어진 전류 파일에 대해 Y V = I를 풀어, Y-Matrix 대신 각 node의 전압을 출력
+*         --powerflow=(파일): 주어진 모선 파일로 전력 조류 계산을 하여, Y-Matrix 대신 각 모선의 전압과 전력을 출력
+*         --contingency=(파일): 주어진 전류 파일로 각 선로의 상정 사고(N-1)를 계산하여, 전압 범위 위반을 심각한 순서로 출력
+*         --vmin=(값), --vmax=(값): 상정 사고 계산에서 허용하는 전압 크기의 범위, 기본값은 0.95, 1.05
+*         --reorder=rcm: 행과 열을 Reverse Cuthill-McKee 순서로 바꾸어 출력하고, 바꾸기 전후의 bandwidth와 profile을 출력
+*         --perm-output=(파일): 출력한 행렬의 행과 열의 순서(node 번호)를 CSV 파일로 저장
+*         --precision=float|double|long-double: Y-Matrix 구성에 사용할 실수 형식, 기본값은 long-double
+*         --kron=(파일): 주어진 파일의 node만 남기고 나머지 node를 소거한(Kron 축약) Y-Matrix를 사용
+*         --fault=(파일): 주어진 파일의 각 node에 3상 단락 고장이 난 경우의 고장 전류를 출력
+*         --fault-voltage=(파일): 고장 계산에서 각 고장 후의 전압을 CSV 파일로 저장
+*         --multiply=(파일): 주어진 전압 파일의 전압(1개 이상)에 Y-Matrix를 곱하여, Y-Matrix 대신 각 node의 전류를 출력
+*         --bench-spmv: 구성한 Y-Matrix와 임의의 전압의 곱셈 시간과 처리량(GFLOP/s)을 측정
+*         --generate=radial|mesh|random: 입력 파일 대신, 주어진 형태의 임의의 계통을 생성하여 입력 파일 양식으로 출력
+*         --branches=(수): 생성할 계통의 선로 수, 기본값은 1000
+*         --bench-suite[=형태,...]: 주어진 형태(기본값은 radial,mesh,random)의 계통을 생성하여, 단계별 시간을 CSV 형식으로 출력
+*         --bench-max=(수): --bench-suite에서 측정할 최대 선로 수, 기본값은 1000000
+*         --scenarios=(파일): 입력 파일의 구조를 공유하고 선로의 R, L, C만 다른 시나리오들의 Y-Matrix를 구성하여, --output의 시나리오 Binary 파일로 저장
+*         --split-output=(directory): 시나리오를 하나의 파일 대신, 시나리오마다 --format 형식의 파일로 출력
+*         --variants=(파일): 구성한 Y-Matrix를 공유하는 변형 계통들에 차이를 적용하여, Y-Matrix 대신 각 변형 계통에서 달라진 값을 출력
+*         --materialize=(이름): 주어진 변형 계통의 전체 Y-Matrix를 만들어, 이후의 계산과 출력에 사용
+*         --stream[=(파일)]: 입력 파일을 기본 계통으로 하여, 변경 기록(+/- 선로, ~ 변압기 tap)을 표준 입력(또는 주어진 파일)에서 읽어 바로 적용하고, 묶음마다 바뀐 값만을 출력
+*         --serve=(socket 파일): 입력 파일의 계통을 memory에 두고, Unix domain socket으로 받은 요청(값, 행, 선로 추가/제거, 전체 출력)에 응답 (Linux)
+*         --stats[=(파일)]: 주요 함수의 호출 횟수와 단계별 걸린 시간을 JSON 형식으로 표준 오류(또는 주어진 파일)에 출력
+* 최종 수정일: 2026/10/17
 */
-Y_Matrix::~Y_Matrix()
+int main(int argc, char* argv[])
 {
-    // 벡터 초기화
-    lineValue.clear();
+    // 변수 선언
+    long long int maxLength = 0; // node의 최댓값
+    std::vector<Branch_Val> branch; // 입력 파일에서 읽어들인 선로 정보
+    std::vector<Device_Val> device; // 입력 파일에서 읽어들인 변압기, 병렬 소자 정보
+    std::vector<long long int> inputNode; // 입력 파일에 나온 node 번호(오름차순)
+    std::string errorMessage; // 입력 파일의 형식 오류 내용
+    std::string outputFormat = "dense", outputPath = "", binaryPath = ""; // 출력 형식, 출력할 파일의 위치, Binary 파일로 저장할 위치
+    Y_Matrix_CSR yMatrixCSR; // CSR 형태의 Y-Matrix
+    int threadCount = 1; // Y-Matrix 구성에 사용할 thread 수
+    bool isDeterministic = false; // 여러 thread를 사용할 때 합산 순서를 고정하는지 여부
+    std::string currentPath = ""; // Y V = I를 풀 때 사용할 전류 파일의 위치
+    std::string busPath = ""; // 전력 조류 계산에 사용할 모선 파일의 위치
+    std::string contingencyPath = ""; // 상정 사고 계산에 사용할 전류 파일의 위치
+    double minVoltage = 0.95, maxVoltage = 1.05; // 상정 사고 계산에서 허용하는 전압 크기의 범위
+    std::string reorderMethod = "", permPath = ""; // 행과 열의 순서를 바꾸는 방법, 순서를 저장할 파일의 위치
+    std::string precision = "long-double"; // Y-Matrix 구성에 사용할 실수 형식
+    std::string keepPath = ""; // Kron 축약에서 남길 node 목록 파일의 위치
+    std::string faultPath = "", faultVoltagePath = ""; // 고장 node 목록 파일의 위치, 고장 후 전압을 저장할 파일의 위치
+    std::string voltagePath = ""; // Y-Matrix를 곱할 전압 파일의 위치
+    bool isMultiplyBench = false; // Y-Matrix 곱셈 시간을 측정하는지 여부
+    std::string generateTopology = ""; // 생성할 계통의 형태
+    long long int generateBranchCount = 1000; // 생성할 계통의 선로 수
+    std::vector<std::string> suiteTopology; // 단계별 시간을 측정할 계통의 형태
+    long long int suiteMaxBranchCount = 1000000; // 단계별 시간을 측정할 최대 선로 수
+    bool isStream = false; // 변경 기록을 읽어 Y-Matrix에 바로 적용하는지 여부
+    std::string streamPath = ""; // 변경 기록을 읽을 파일의 위치(빈 문자열이면 표준 입력)
+    std::string socketPath = ""; // 요청을 받을 Unix domain socket의 위치
+    std::string scenarioPath = "", splitPath = ""; // 시나리오 파일의 위치, 시나리오마다 파일을 출력할 directory
+    std::string variantPath = "", materializeName = ""; // 변형 계통 파일의 위치, 전체 Y-Matrix를 만들 변형 계통의 이름
+    std::vector<std::string> variantName; // 각 변형 계통의 이름
+    std::vector<std::shared_ptr<Y_Matrix_Variant>> variant; // 각 변형 계통
+#if Y_MATRIX_STATS
+    std::string statsPath = ""; // 실행 통계를 저장할 파일의 위치(빈 문자열이면 표준 오류)
+#endif
+    
+    // 파일의 위치 저장
+    std::string filePath = "";
+    // 파일 주소에 빈칸이 있는 경우, 이를 처리한다.
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
 
-    return;
-}
+        // 옵션 처리
+        if (argument == "--bench")
+        {
+            benchmarkBuild();
+            return 0;
+        }else if (argument.rfind("--format=", 0) == 0)
+        {
+            outputFormat = argument.substr(9);
+            if (outputFormat != "dense" && outputFormat != "mtx" && outputFormat != "csv")
+            {
+                std::cout << "Unknown Format: " << outputFormat << std::endl;
+                return 1;
+            }
+            continue;
+        }else if (argument.rfind("--output=", 0) == 0)
+        {
+            outputPath = argument.substr(9);
+            continue;
+        }else if (argument.rfind("--save-bin=", 0) == 0)
+        {
+            binaryPath = argument.substr(11);
+            continue;
+        }else if (argument.rfind("--threads=", 0) == 0)
+        {
+            threadCount = atoi(argument.c_str() + 10);
+            if (threadCount < 1)
+            {
+                std::cout << "Invalid Thread Count: " << argument.substr(10) << std::endl;
+                return 1;
+            }
+            continue;
+        }else if (argument == "--deterministic")
+        {
+            isDeterministic = true;
+            continue;
+        }else if (argument.rfind("--solve=", 0) == 0)
+        {
+            currentPath = argument.substr(8);
+            continue;
+        }else if (argument.rfind("--powerflow=", 0) == 0)
+        {
+            busPath = argument.substr(12);
+            continue;
+        }else if (argument.rfind("--contingency=", 0) == 0)
+        {
+            contingencyPath = argument.substr(14);
+            continue;
+        }else if (argument.rfind("--vmin=", 0) == 0)
+        {
+            minVoltage = atof(argument.c_str() + 7);
+            continue;
+        }else if (argument.rfind("--vmax=", 0) == 0)
+        {
+            maxVoltage = atof(argument.c_str() + 7);
+            continue;
+        }else if (argument.rfind("--reorder=", 0) == 0)
+        {
+            reorderMethod = argument.substr(10);
+            if (reorderMethod != "rcm")
+            {
+                std::cout << "Unknown Reordering: " << reorderMethod << std::endl;
+                return 1;
+            }
+            continue;
+        }else if (argument.rfind("--perm-output=", 0) == 0)
+        {
+            permPath = argument.substr(14);
+            continue;
+        }else if (argument.rfind("--precision=", 0) == 0)
+        {
+            precision = argument.substr(12);
+            if (precision != "float" && precision != "double" && precision != "long-double")
+            {
+                std::cout << "Unknown Precision: " << precision << std::endl;
+                return 1;
+            }
+            continue;
+        }else if (argument.rfind("--kron=", 0) == 0)
+        {
+            keepPath = argument.substr(7);
+            continue;
+        }else if (argument.rfind("--fault=", 0) == 0)
+        {
+            faultPath = argument.substr(8);
+            continue;
+        }else if (argument.rfind("--fault-voltage=", 0) == 0)
+        {
+            faultVoltagePath = argument.substr(16);
+            continue;
+        }else if (argument.rfind("--multiply=", 0) == 0)
+        {
+            voltagePath = argument.substr(11);
+            continue;
+        }else if (argument == "--bench-spmv")
+        {
+            isMultiplyBench = true;
+            continue;
+        }else if (argument.rfind("--generate=", 0) == 0)
+        {
+            generateTopology = argument.substr(11);
+            if (generateTopology != "radial" && generateTopology != "mesh" && generateTopology != "random")
+            {
+                std::cout << "Unknown Topology: " << generateTopology << std::endl;
+                return 1;
+            }
+            continue;
+        }else if (argument.rfind("--branches=", 0) == 0)
+        {
+            generateBranchCount = atoll(argument.c_str() + 11);
+            if (generateBranchCount < 1)
+            {
+                std::cout << "Invalid Branch Count: " << argument.substr(11) << std::endl;
+                return 1;
+            }
+            continue;
+        }else if (argument == "--bench-suite" || argument.rfind("--bench-suite=", 0) == 0)
+        {
+            std::string topologyList = argument == "--bench-suite" ? "radial,mesh,random" : argument.substr(14);
+            suiteTopology.clear();
+            for (unsigned long long int start = 0; start <= topologyList.size(); )
+            {
+                unsigned long long int end = std::min(topologyList.find(',', start), topologyList.size());
+                std::string topologyName = topologyList.substr(start, end - start);
+                if (topologyName != "radial" && topologyName != "mesh" && topologyName != "random")
+                {
+                    std::cout << "Unknown Topology: " << topologyName << std::endl;
+                    return 1;
+                }
+                suiteTopology.push_back(topologyName);
+                start = end + 1;
+            }
+            continue;
+        }else if (argument == "--stream" || argument.rfind("--stream=", 0) == 0)
+        {
+            isStream = true;
+            streamPath = argument == "--stream" ? "" : argument.substr(9);
+            continue;
+        }else if (argument.rfind("--scenarios=", 0) == 0)
+        {
+            scenarioPath = argument.substr(12);
+            continue;
+        }else if (argument.rfind("--split-output=", 0) == 0)
+        {
+            splitPath = argument.substr(15);
+            continue;
+        }else if (argument.rfind("--variants=", 0) == 0)
+        {
+            variantPath = argument.substr(11);
+            continue;
+        }else if (argument.rfind("--materialize=", 0) == 0)
+        {
+            materializeName = argument.substr(14);
+            continue;
+        }else if (argument.rfind("--serve=", 0) == 0)
+        {
+#ifdef __linux__
+            socketPath = argument.substr(8);
+            continue;
+#else
+            std::cout << "Server Mode Is Only Supported on Linux" << std::endl;
+            return 1;
+#endif
+        }else if (argument == "--stats" || argument.rfind("--stats=", 0) == 0)
+        {
+#if Y_MATRIX_STATS
+            isStatsEnabled = true;
+            statsPath = argument == "--stats" ? "" : argument.substr(8);
+            continue;
+#else
+            std::cout << "Statistics Disabled (Compiled with Y_MATRIX_STATS=0)" << std::endl;
+            return 1;
+#endif
+        }else if (argument.rfind("--bench-max=", 0) == 0)
+        {
+            suiteMaxBranchCount = atoll(argument.c_str() + 12);
+            if (suiteMaxBranchCount < 10)
+            {
+                std::cout << "Invalid Branch Count: " << argument.substr(12) << std::endl;
+                return 1;
+            }
+            continue;
+        }
 
-/* Y_Matrix::findMatrix() 함수
-* 
-* 기능: lineValue Vector에서 특정 node의 값을 가진 값의 위치를 찾는다.
-* 입력값: node1, node2
-* 출력값: lineValue Vector에서 해당 node의 값이 저장된 위치(저장되지 않은 경우, -1 반환)
-* 최종 수정일: 2024/10/06
-*/
-long long int Y_Matrix::findMatrix(long long int Node1, long long int Node2)
-{
-    // vector의 길이만큼 반복
-    for (unsigned long long int i = 0; i < lineValue.size(); i++)
-    {
-        // 해당 node의 값을 찾은 경우, 해당 위치 출력
-        if (lineValue[i].node1 == Node1 && lineValue[i].node2 == Node2)
+        if (!filePath.empty())
         {
-            return i;
+            filePath += " ";
         }
+        filePath += argument;
     }
-    // 해당 node의 값이 저장되지 않은 경우, -1 출력
-    return -1;
-}
-
-/* Y_Matrix::isValueEmpty() 함수
-*
-* 기능: lineValue Vector에서 특정 위치의 값이 0인지 확인한다.
-* 입력값: cursor
-* 출력값: 특정 위치의 어드미턴스 값이 0인 경우 참을, 그렇지 않은 경우 거짓을 반환한다.
-* 최종 수정일: 2024/10/05
-*/
-bool Y_Matrix::isValueEmpty(long long int cursor)
-{
-    // 특정 위치의 어드미턴스 값이 0인 경우 참을, 그렇지 않은 경우 거짓을 반환한다.
-    return (lineValue[cursor].G == 0 && lineValue[cursor].jB == 0);
-}
-
-/* Y_Matrix::addMatrix() 함수
-* 
-* 기능: Y-Matrix에 특정 값을 추가한다. 입력된 두 node가 같은 경우와 다른 경우를 구분한다.
-* 입력값: Node1, Node2, R, L, C값
-* 출력값 없음
-* 최종 수정일: 2024/10/05
-*/
-void Y_Matrix::addMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C)
-{
-    // 값을 저장하기 위한 yMatrixVal 생성
-    Y_Matrix_Val yMatrixVal;
+    // 계통 생성과 단계별 시간 측정은 입력 파일 없이 실행하며, 결과를 주어진 파일(지정하지 않은 경우, 표준 출력)에 출력한다.
+    if (!generateTopology.empty() || !suiteTopology.empty())
+    {
+        FILE* outputFile = outputPath.empty() ? stdout : fopen(outputPath.c_str(), "wb");
+        bool isSucceeded = true, isWritten;
+        if (outputFile == NULL)
+        {
+            std::cout << "Cannot Open Output File" << std::endl;
+            return 1;
+        }
 
-    // 어드미턴스 값을 미리 계산하기 위한 변수 생성
-    long double realVal, imagVal;
+        {
+            Output_Writer writer(outputFile);
+
+            if (!suiteTopology.empty())
+            {
+                isSucceeded = benchmarkSuite(suiteTopology, suiteMaxBranchCount, writer);
+            }else{
+                writeBranchFile(generateNetwork(generateTopology, generateBranchCount), writer);
+            }
+            writer.flush();
+            isWritten = !writer.failed();
+        }
+        if (outputFile != stdout)
+        {
+            isWritten = (fclose(outputFile) == 0) && isWritten;
+        }
+        if (!isSucceeded)
+        {
+            std::cout << "Cannot Create Temporary File" << std::endl;
+            return 1;
+        }
+        if (!isWritten)
+        {
+            std::cout << "Cannot Write Output File" << std::endl;
+            return 1;
+        }
 
-    // 저장할 값의 위치를 찾기
-    long long int location = findMatrix(Node1, Node2);
+        return 0;
+    }
 
-    // 두 node가 같은 경우
-    if (Node1 == Node2)
+    // 파일 열기
+    STATS_PHASE_BEGIN(PHASE_READ);
+    Mapped_File inputFile;
+    // 파일 열기 실패 시, 프로그램을 종료한다.
+    if (!inputFile.open(filePath))
     {
-        realVal = RealValCalc(R, L);
-        imagVal = ImagValCalc(R, L) + C / 2;
-    }else{ // 두 node가 다른 경우
-        realVal = -RealValCalc(R, L);
-        imagVal = -ImagValCalc(R, L);
+        std::cout << "File Not Found" << std::endl;
+        return 1;
     }
 
-    // 해당 node가 저장된 위치가 존재하는 경우
-    if (location != -1)
+    // Binary 파일인 경우, 저장된 선로 정보와 Y-Matrix를 바로 읽는다.
+    bool isBinaryInput = isBinaryNetwork(inputFile.data(), inputFile.size());
+    if (isBinaryInput)
     {
-        // 계산한 값을 추가한다.
-        lineValue[location].G += realVal;
-        lineValue[location].jB += imagVal;
-
-        // 추가된 값이 0이 된 경우, 해당 데이터를 vector에서 지운다.
-        if (isValueEmpty(location))
+        if (!loadBinaryNetwork(inputFile.data(), inputFile.size(), branch, device, yMatrixCSR, maxLength, errorMessage))
         {
-            lineValue.erase(lineValue.begin() + location);
+            std::cout << "Invalid Input File - " << errorMessage << std::endl;
+            return 1;
         }
-    }else{ // 해당 node가 저장된 위치가 존재하지 않는 경우
-        // vector에 해당 값을 추가하기 위해 Y_Matrix_Val 구조체 형식으로 저장한다.
-        yMatrixVal.node1 = Node1;
-        yMatrixVal.node2 = Node2;
-        yMatrixVal.G = realVal;
-        yMatrixVal.jB = imagVal;
 
-        // 해당 값을 vector에 추가한다.
-        lineValue.push_back(yMatrixVal);
-    }
+        // 파일 닫기
+        inputFile.close();
 
-    return;
-}
+        inputNode = collectNodes(branch, device, yMatrixCSR.nodeNum);
+        STATS_PHASE_END(PHASE_READ);
+    }else{
+        STATS_PHASE_END(PHASE_READ);
 
-/* Y_Matrix::subtractMatrix() 함수
-*
-* 기능: Y-Matrix에 특정 값을 감산한다. 입력된 두 node가 같은 경우와 다른 경우를 구분한다.
-* 입력값: Node1, Node2, R, L, C값
-* 출력값 없음
-* 최종 수정일: 2024/10/05
-*/
-void Y_Matrix::subtractMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C)
-{
-    // 값을 저장하기 위한 yMatrixVal 생성
-    Y_Matrix_Val yMatrixVal;
-
-    // 어드미턴스 값을 미리 계산하기 위한 변수 생성
-    long double realVal, imagVal;
+        // 파일의 모든 줄을 읽는다. 형식에 맞지 않는 줄이 있는 경우, 프로그램을 종료한다.
+        STATS_PHASE_BEGIN(PHASE_PARSE);
+        if (!parseBranchFile(inputFile.data(), inputFile.size(), branch, errorMessage, &device))
+        {
+            std::cout << "Invalid Input File - " << errorMessage << std::endl;
+            return 1;
+        }
 
-    // 저장할 값의 위치를 찾기
-    long long int location = findMatrix(Node1, Node2);
+        // 파일 닫기
+        inputFile.close();
+        inputNode = collectNodes(branch, device, std::vector<long long int>());
+        STATS_PHASE_END(PHASE_PARSE);
+    }
 
-    // 두 node가 같은 경우
-    if (Node1 == Node2)
+    // 출력할 행과 열의 순서(node 번호의 오름차순)
+    std::vector<long long int> busNum = inputNode;
+    if (!busNum.empty() && busNum.back() > maxLength)
     {
-        realVal = RealValCalc(R, L);
-        imagVal = ImagValCalc(R, L) + C / 2;
-    }else{ // 두 node가 다른 경우
-        realVal = -RealValCalc(R, L);
-        imagVal = -ImagValCalc(R, L);
+        maxLength = busNum.back();
     }
 
-    // 해당 node가 저장된 위치가 존재하는 경우
-    if (location != -1)
+    // 변경 기록을 읽는 경우, 입력 파일을 기본 계통으로 하여 각 변경을 바로 적용하고 바뀐 값만을 출력한다.
+    if (isStream)
     {
-        // 계산한 값을 감산한다.
-        lineValue[location].G -= realVal;
-        lineValue[location].jB -= imagVal;
+        FILE* changeFile = streamPath.empty() ? stdin : fopen(streamPath.c_str(), "rb");
+        FILE* outputFile = outputPath.empty() ? stdout : fopen(outputPath.c_str(), "wb");
+        bool isSucceeded, isWritten;
+        if (changeFile == NULL)
+        {
+            std::cout << "Change Log Not Found" << std::endl;
+            return 1;
+        }
+        if (outputFile == NULL)
+        {
+            std::cout << "Cannot Open Output File" << std::endl;
+            return 1;
+        }
 
-        // 추가된 값이 0이 된 경우, 해당 데이터를 vector에서 지운다.
-        if (isValueEmpty(location))
+        STATS_PHASE_BEGIN(PHASE_STREAM);
+        {
+            Output_Writer writer(outputFile);
+
+            if (precision == "float")
+            {
+                isSucceeded = streamChanges<float, long long int>(branch, device, changeFile, writer);
+            }else if (precision == "double")
+            {
+                isSucceeded = streamChanges<double, long long int>(branch, device, changeFile, writer);
+            }else{
+                isSucceeded = streamChanges<long double, long long int>(branch, device, changeFile, writer);
+            }
+            writer.flush();
+            isWritten = !writer.failed();
+        }
+        if (changeFile != stdin)
         {
-            lineValue.erase(lineValue.begin() + location);
+            fclose(changeFile);
         }
-    }else{ // 해당 node가 저장된 위치가 존재하지 않는 경우
-        // vector에 해당 값을 0에서 감산하기 위해 Y_Matrix_Val 구조체 형식으로 저장한다.
-        yMatrixVal.node1 = Node1;
-        yMatrixVal.node2 = Node2;
-        yMatrixVal.G = -realVal;
-        yMatrixVal.jB = -imagVal;
+        if (outputFile != stdout)
+        {
+            isWritten = (fclose(outputFile) == 0) && isWritten;
+        }
+        if (isSucceeded && !isWritten)
+        {
+            std::cout << "Cannot Write Output File" << std::endl;
+            isSucceeded = false;
+        }
+        STATS_PHASE_END(PHASE_STREAM);
+#if Y_MATRIX_STATS
+        if (isStatsEnabled && !saveStats(statsPath))
+        {
+            return 1;
+        }
+#endif
 
-        // 해당 값을 vector에 추가한다.
-        lineValue.push_back(yMatrixVal);
+        return isSucceeded ? 0 : 1;
     }
 
-    return;
-}
+    // 시나리오 파일이 주어진 경우, 입력 파일의 구조로 모든 시나리오의 Y-Matrix를 구성하여 저장한다.
+    if (!scenarioPath.empty())
+    {
+        // 시나리오는 선로의 R, L, C만 바꾸므로, 변압기와 병렬 소자가 있는 입력 파일과 함께 사용할 수 없다.
+        if (!device.empty())
+        {
+            std::cout << "Scenarios Cannot Be Used with Transformer or Shunt Records" << std::endl;
+            return 1;
+        }
 
-/* Y_Matrix::addMatrixPackage() 함수
-*
-* 기능: Y-Matrix에 특정 node의 값을 추가하도록 한다.
-* 입력값: Node1, Node2, R, L, C값
-* 출력값 없음
-* 최종 수정일: 2024/10/06
-*/
-void Y_Matrix::addMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C)
-{
-    // node1 > node2인 경우, 두 값을 서로 바꾼다.
-    if (Node1 > Node2)
+        bool isSucceeded;
+        STATS_PHASE_BEGIN(PHASE_SCENARIO);
+        if (precision == "float")
+        {
+            isSucceeded = buildScenarios<float>(branch, busNum, scenarioPath, threadCount, outputPath, splitPath, outputFormat);
+        }else if (precision == "double")
+        {
+            isSucceeded = buildScenarios<double>(branch, busNum, scenarioPath, threadCount, outputPath, splitPath, outputFormat);
+        }else{
+            isSucceeded = buildScenarios<long double>(branch, busNum, scenarioPath, threadCount, outputPath, splitPath, outputFormat);
+        }
+        STATS_PHASE_END(PHASE_SCENARIO);
+#if Y_MATRIX_STATS
+        if (isStatsEnabled && !saveStats(statsPath))
+        {
+            return 1;
+        }
+#endif
+        return isSucceeded ? 0 : 1;
+    }
+
+#ifdef __linux__
+    // server로 실행하는 경우, 입력 파일의 계통을 memory에 두고 종료 signal을 받을 때까지 요청에 응답한다.
+    if (!socketPath.empty())
     {
-        std::swap(Node1, Node2);
+        STATS_PHASE_BEGIN(PHASE_SERVE);
+        if (!serveMatrix(branch, device, socketPath, threadCount))
+        {
+            std::cout << "Cannot Open Socket: " << socketPath << std::endl;
+            return 1;
+        }
+        STATS_PHASE_END(PHASE_SERVE);
+#if Y_MATRIX_STATS
+        if (isStatsEnabled && !saveStats(statsPath))
+        {
+            return 1;
+        }
+#endif
+        return 0;
     }
+#endif
 
-    // node1 추가
-    addMatrix(Node1, Node1, R, L, C);
-    // node2 추가
-    addMatrix(Node2, Node2, R, L, C);
-    // node1 - node2 추가
-    addMatrix(Node1, Node2, R, L, C);
+    // 읽은 데이터를 바탕으로, Y-Matrix 계산 및 저장을 진행한다. (Binary 파일은 이미 구성된 Y-Matrix를 읽었다.)
+    if (!isBinaryInput)
+    {
+        // 모든 node 번호가 32bit 정수 범위 안에 있는 경우, node 번호를 32bit로 저장한다.
+        bool isSmallIndex = busNum.empty() || (busNum.front() > INT32_MIN && busNum.back() <= INT32_MAX);
 
-    return;
-}
+        if (precision == "float")
+        {
+            yMatrixCSR = isSmallIndex ? buildMatrix<float, int32_t>(branch, device, threadCount, isDeterministic) : buildMatrix<float, long long int>(branch, device, threadCount, isDeterministic);
+        }else if (precision == "double")
+        {
+            yMatrixCSR = isSmallIndex ? buildMatrix<double, int32_t>(branch, device, threadCount, isDeterministic) : buildMatrix<double, long long int>(branch, device, threadCount, isDeterministic);
+        }else{
+            yMatrixCSR = buildMatrix<long double, long long int>(branch, device, threadCount, isDeterministic);
+        }
+    }
 
-/* Y_Matrix::subtractMatrixPackage() 함수
-*
-* 기능: Y-Matrix에 특정 node의 값을 감산하도록 한다.
-* 입력값: Node1, Node2, R, L, C값
-* 출력값 없음
-* 최종 수정일: 2024/10/06
-*/
-void Y_Matrix::subtractMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C)
-{
-    // node1 > node2인 경우, 두 값을 서로 바꾼다.
-    if (Node1 > Node2)
+    // Binary 파일로 저장한다.
+    if (!binaryPath.empty() && !saveBinaryNetwork(binaryPath, branch, device, yMatrixCSR, maxLength))
     {
-        std::swap(Node1, Node2);
+        std::cout << "Cannot Save Binary File" << std::endl;
+        return 1;
     }
 
-    // node1 감산
-    subtractMatrix(Node1, Node1, R, L, C);
-    // node2 감산
-    subtractMatrix(Node2, Node2, R, L, C);
-    // node1 - node2 감산
-    subtractMatrix(Node1, Node2, R, L, C);
-
-    return;
-}
-
-/* Y_Matrix::getMatrix() 함수
-*
-* 기능: Y-Matrix에서 특정 node의 값을 읽어온다.
-* 입력값: Node1, Node2
-* 출력값: 해당 node의 어드미턴스의 실수값과 허수값
-* 최종 수정일: 2024/10/05
-*/
-long double* Y_Matrix::getMatrix(long long int Node1, long long int Node2)
-{
-    // 출력값을 저장하기 위한 변수 선언(Call-by Reference를 위해 static으로 설정)
-    static long double matrixVal[2] = {0, 0};
+    // 변형 계통 파일이 주어진 경우, 구성한 Y-Matrix를 공유하는 각 변형 계통에 차이를 적용한다.
+    // 기본 계통은 복사하지 않고 yMatrixCSR를 가리키므로(해제하지 않는 shared_ptr), 변형 계통이 남아 있는 동안 yMatrixCSR를 바꾸지 않는다.
+    if (!variantPath.empty())
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        std::shared_ptr<const Y_Matrix_CSR> baseCSR(&yMatrixCSR, [](const Y_Matrix_CSR*) {});
+        if (!readVariantFile(variantPath, baseCSR, branch, variantName, variant))
+        {
+            return 1;
+        }
+        double variantTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
 
-    // 내부 변수 선언
-    long long int location; // lineValue vector에서 원하는 값의 위치를 나타내는 변수
+        long long int overlayCount = 0;
+        unsigned long long int overlayMemory = 0, baseMemory;
+        for (unsigned long long int i = 0; i < variant.size(); i++)
+        {
+            overlayCount += variant[i]->overlayCount();
+            overlayMemory += variant[i]->memoryUsage();
+        }
+        baseMemory = (baseCSR->nodeNum.capacity() + baseCSR->rowPtr.capacity() + baseCSR->colIdx.capacity()) * sizeof(long long int) + (baseCSR->G.capacity() + baseCSR->jB.capacity()) * sizeof(long double);
+        std::cerr << std::fixed << std::setprecision(3) << "Variants: " << variant.size() << ", Overlay Entries: " << overlayCount
+            << ", Overlay Memory: " << overlayMemory << " Bytes, Base Memory: " << baseMemory << " Bytes, Time: " << variantTime << " ms" << std::endl;
 
-    // node1 > node2인 경우, 두 값을 서로 바꾼다.
-    if (Node1 > Node2)
+        // 전체 Y-Matrix를 만들 변형 계통이 주어진 경우, 이후의 계산과 출력에 해당 변형 계통을 사용한다.
+        if (!materializeName.empty())
+        {
+            auto variantLocation = std::find(variantName.begin(), variantName.end(), materializeName);
+            if (variantLocation == variantName.end())
+            {
+                std::cout << "Unknown Variant: " << materializeName << std::endl;
+                return 1;
+            }
+            // 기본 계통(yMatrixCSR)을 가리키는 변형 계통을 모두 해제한 뒤에 바꾼다.
+            Y_Matrix_CSR materializedCSR = variant[variantLocation - variantName.begin()]->materialize();
+            variant.clear();
+            baseCSR.reset();
+            yMatrixCSR = std::move(materializedCSR);
+
+            // 변형 계통에서 새로 생긴 node를 추가한다.
+            inputNode = collectNodes(branch, device, yMatrixCSR.nodeNum);
+            busNum = inputNode;
+        }
+    }else if (!materializeName.empty())
     {
-        std::swap(Node1, Node2);
+        std::cout << "Variant File Not Given" << std::endl;
+        return 1;
     }
 
-    // 입력받은 두 node의 값을 가지고 있는 위치를 찾는다.
-    location = findMatrix(Node1, Node2);
+    // Kron 축약을 하는 경우, 남길 node만으로 이루어진 Y-Matrix로 바꾸고 소거 결과를 표준 오류로 출력한다.
+    if (!keepPath.empty())
+    {
+        // 상정 사고 계산은 소거된 node의 선로도 사용하므로, 함께 사용할 수 없다.
+        if (!contingencyPath.empty())
+        {
+            std::cout << "Kron Reduction Cannot Be Used with Contingency Analysis" << std::endl;
+            return 1;
+        }
+        // 변형 계통은 축약 전의 Y-Matrix를 기본 계통으로 사용하므로, 하나의 변형 계통을 전체 Y-Matrix로 만든 경우에만 사용할 수 있다.
+        if (!variant.empty())
+        {
+            std::cout << "Kron Reduction Cannot Be Used with Variants Without --materialize" << std::endl;
+            return 1;
+        }
 
-    // 두 node의 값이 저장되어 있는 경우
-    if (location != -1)
-    {  
-        // 해당 값을 반환한다.
-        matrixVal[0] = lineValue[location].G;
-        matrixVal[1] = lineValue[location].jB;
-        return matrixVal;
-    }
+        std::vector<long long int> keepNode;
+        if (!readNodeFile(keepPath, "Keep", inputNode, keepNode))
+        {
+            return 1;
+        }
+        std::sort(keepNode.begin(), keepNode.end());
 
-    // 두 node의 값이 저장되어 있지 않은 경우, 0을 반환한다.
-    matrixVal[0] = 0;
-    matrixVal[1] = 0;
-    return matrixVal;
-}
+        Y_Matrix_CSR reducedCSR;
+        long long int fillCount;
+        STATS_PHASE_BEGIN(PHASE_KRON);
+        auto startTime = std::chrono::steady_clock::now();
+        if (!reduceKron(yMatrixCSR, keepNode, reducedCSR, fillCount))
+        {
+            std::cout << "Singular Y-Matrix in Eliminated Nodes" << std::endl;
+            return 1;
+        }
+        double reduceTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        STATS_PHASE_END(PHASE_KRON);
 
-/*
-* main() 함수
-* 기능: File을 읽고, Y-Matrix을 계산해 출력한다.
-* 입력값: file 인수
-* 최종 수정일: 2024/10/05
-*/
-void main(int argc, char* argv[])
-{
-    // Class 호출
-    Y_Matrix yMatrix1;
+        std::cerr << std::fixed << std::setprecision(3) << "Kept: " << keepNode.size() << ", Eliminated: " << busNum.size() - keepNode.size()
+            << ", Fill-in: " << fillCount << ", Nonzeros: " << yMatrixCSR.colIdx.size() << " -> " << reducedCSR.colIdx.size() << ", Time: " << reduceTime << " ms" << std::endl;
 
-    // 변수 선언
-    long long int node1, node2, maxLength = 0; // 순서대로 읽어들인 node1, node2값, node의 최댓값
-    long double R, L, C, *ans; // 순서대로 읽어들인 R, L, C값, 해당 위치의 어드미턴스값을 저장하는 위치를 가리키는 포인터
-    
-    // 파일의 위치 저장
-    std::string filePath = "";
-    // 파일 주소에 빈칸이 있는 경우, 이를 처리한다.
-    for (int i = 1; i < argc; i++)
-    {
-        filePath += argv[i];
-        filePath += " ";
-    }
-    // 파일 열기
-    std::ifstream inputFile(filePath);
-    // 파일 열기 실패 시, 프로그램을 종료한다.
-    if (!inputFile.is_open())
-    {
-        std::cout << "File Not Found" << std::endl;
-        return;
+        yMatrixCSR = std::move(reducedCSR);
+        busNum = std::move(keepNode);
     }
 
-    // 파일 끝까지 반복
-    while (!inputFile.eof())
+    // 행과 열의 순서를 바꾸는 경우, Reverse Cuthill-McKee 순서를 구하고 bandwidth와 profile의 변화를 표준 오류로 출력한다.
+    if (reorderMethod == "rcm")
     {
-        // 파일의 해당 줄 읽기
-        inputFile >> node1 >> node2 >> R >> L >> C;
-        // 읽은 데이터를 바탕으로, Y-Matrix 계산 및 저장을 진행한다.
-        yMatrix1.addMatrixPackage(node1, node2, R, L, C);
+        STATS_PHASE_BEGIN(PHASE_REORDER);
+        auto startTime = std::chrono::steady_clock::now();
+        std::vector<long long int> order = reorderRCM(yMatrixCSR);
+        double reorderTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        std::vector<long long int> naturalOrder(yMatrixCSR.nodeNum.size());
+        long long int bandwidth[2], profile[2]; // 바꾸기 전, 후의 값
+        for (unsigned long long int i = 0; i < naturalOrder.size(); i++)
+        {
+            naturalOrder[i] = i;
+        }
+        measureBandwidth(yMatrixCSR, naturalOrder, bandwidth[0], profile[0]);
+        measureBandwidth(yMatrixCSR, order, bandwidth[1], profile[1]);
 
-        // node의 번호가 최댓값인 경우, 해당 값을 maxLength 변수에 저장한다.
-        if (node1 > maxLength)
-            maxLength = node1;
+        // 바뀐 순서대로 node 번호를 나열한다. (값이 모두 0이 되어 행이 없는 node는 마지막에 둔다.)
+        std::vector<long long int> reorderedNum;
+        for (unsigned long long int i = 0; i < order.size(); i++)
+        {
+            reorderedNum.push_back(yMatrixCSR.nodeNum[order[i]]);
+        }
+        for (unsigned long long int i = 0; i < busNum.size(); i++)
+        {
+            if (yMatrixCSR.findRow(busNum[i]) == -1)
+            {
+                reorderedNum.push_back(busNum[i]);
+            }
+        }
+        busNum = std::move(reorderedNum);
 
-        if (node2 > maxLength)
-            maxLength = node2;
+        std::cerr << std::fixed << std::setprecision(3) << "Bandwidth: " << bandwidth[0] << " -> " << bandwidth[1]
+            << ", Profile: " << profile[0] << " -> " << profile[1] << ", Time: " << reorderTime << " ms" << std::endl;
+        STATS_PHASE_END(PHASE_REORDER);
     }
 
-    // 파일 닫기
-    inputFile.close();
+    // 행과 열의 순서를 저장한다.
+    if (!permPath.empty() && !writePermutation(permPath, busNum))
+    {
+        std::cout << "Cannot Save Permutation File" << std::endl;
+        return 1;
+    }
 
-    // 행렬의 크기를 출력한다.
-    std::cout << maxLength << "*" << maxLength << " Matrix" << std::endl;
+    // 출력할 파일 열기(지정하지 않은 경우, 표준 출력)
+    FILE* outputFile = outputPath.empty() ? stdout : fopen(outputPath.c_str(), "wb");
+    if (outputFile == NULL)
+    {
+        std::cout << "Cannot Open Output File" << std::endl;
+        return 1;
+    }
 
-    // 행렬을 모두 출력한다.
-    for (int i = 0; i < maxLength; i++)
+    // 주어진 형식으로 행렬을 출력한다.
+#if Y_MATRIX_STATS
+    // 행렬 대신 계산 결과를 출력하는 경우, 계산 단계의 시간으로 기록한다.
+    Stats_Phase_Id outputPhase = (isMultiplyBench || !variant.empty() || !contingencyPath.empty() || !faultPath.empty() || !voltagePath.empty() || !busPath.empty() || !currentPath.empty()) ? PHASE_ANALYSIS : PHASE_OUTPUT;
+#endif
+    STATS_PHASE_BEGIN(outputPhase);
+    bool isWritten;
     {
-        for (int j = 0; j < maxLength; j++)
+        Output_Writer writer(outputFile);
+
+        if (isMultiplyBench)
+        {
+            // 곱셈 시간 측정 결과는 표준 출력으로 출력한다.
+            benchmarkMultiply(yMatrixCSR, threadCount);
+        }else if (!contingencyPath.empty())
+        {
+            // 상정 사고 계산용 전류 파일이 주어진 경우, 행렬 대신 상정 사고 계산 결과를 출력한다.
+            if (!solveContingency(yMatrixCSR, branch, contingencyPath, threadCount, minVoltage, maxVoltage, writer))
+            {
+                return 1;
+            }
+        }else if (!faultPath.empty())
+        {
+            // 고장 node 목록 파일이 주어진 경우, 행렬 대신 고장 전류를 출력한다.
+            std::vector<long long int> faultNode;
+            if (!readNodeFile(faultPath, "Fault", inputNode, faultNode) || !solveFault(yMatrixCSR, faultNode, threadCount, faultVoltagePath, writer))
+            {
+                return 1;
+            }
+        }else if (!voltagePath.empty())
         {
-            ans = yMatrix1.getMatrix(i + 1, j + 1);
-            std::cout << std::setw(14) << std::fixed << std::setprecision(6) << ans[0] << (ans[1] >= 0 ? '+' : '-') << (ans[1] >= 0 ? ans[1] : -ans[1]) << "  ";
+            // 전압 파일이 주어진 경우, 행렬 대신 각 node의 전류를 출력한다.
+            if (!multiplyVoltage(yMatrixCSR, voltagePath, threadCount, writer))
+            {
+                return 1;
+            }
+        }else if (!variant.empty())
+        {
+            // 변형 계통 파일이 주어진 경우, 행렬 대신 각 변형 계통에서 달라진 값을 출력한다.
+            writeVariants(variantName, variant, writer);
+        }else if (!busPath.empty())
+        {
+            // 모선 파일이 주어진 경우, 행렬 대신 전력 조류 계산 결과를 출력한다.
+            if (!solvePowerFlow(yMatrixCSR, busPath, writer))
+            {
+                return 1;
+            }
+        }else if (!currentPath.empty())
+        {
+            // 전류 파일이 주어진 경우, 행렬 대신 각 node의 전압을 출력한다.
+            if (!solveVoltage(yMatrixCSR, currentPath, writer))
+            {
+                return 1;
+            }
+        }else if (outputFormat == "mtx")
+        {
+            writeMatrixMarket(yMatrixCSR, busNum, writer);
+        }else if (outputFormat == "csv")
+        {
+            writeTripletCSV(yMatrixCSR, busNum, writer);
+        }else{
+            writeDenseMatrix(yMatrixCSR, busNum, writer);
         }
-        std::cout << std::endl;
+        writer.flush();
+        isWritten = !writer.failed();
     }
+    STATS_PHASE_END(outputPhase);
 
-    // Class 내용 초기화
-    yMatrix1.~Y_Matrix();
+    // 출력한 파일 닫기(다 쓰지 못한 경우, 오류로 종료한다.)
+    if (outputFile != stdout)
+    {
+        isWritten = (fclose(outputFile) == 0) && isWritten;
+    }
+    if (!isWritten)
+    {
+        std::cout << "Cannot Write Output File" << std::endl;
+        return 1;
+    }
+
+    // 실행 통계를 출력한다.
+#if Y_MATRIX_STATS
+    if (isStatsEnabled && !saveStats(statsPath))
+    {
+        return 1;
+    }
+#endif
 
-    return;
-}
\ No newline at end of file
+    return 0;
+}
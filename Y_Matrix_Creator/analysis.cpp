@@ -0,0 +1,1094 @@
+﻿#include<iostream>
+#include<iomanip>
+#include<chrono>
+#include<thread>
+#include<atomic>
+#include<limits>
+#include<cstring>
+
+#include "analysis.hpp"
+
+/* readCurrentFile() 함수
+*
+* 기능: 전류 파일을 읽어, 각 node에 주입되는 전류를 Y-Matrix의 행 순서로 정리한다.
+*       전류 파일의 양식은 (Node) (전류 실수부) (전류 허수부)이며, 주어지지 않은 node의 전류는 0으로 한다.
+* 입력값: matrixCSR, currentPath(전류 파일의 위치), current(전류를 저장할 vector)
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool readCurrentFile(const Y_Matrix_CSR& matrixCSR, const std::string& currentPath, std::vector<std::complex<double>>& current)
+{
+    Mapped_File currentFile;
+    std::vector<long long int> currentNode;
+    std::vector<long double> currentValue;
+    std::string errorMessage;
+
+    if (!currentFile.open(currentPath))
+    {
+        std::cout << "Current File Not Found" << std::endl;
+        return false;
+    }
+    if (!parseNodeValueFile(currentFile.data(), currentFile.size(), 2, currentNode, currentValue, errorMessage))
+    {
+        std::cout << "Invalid Current File - " << errorMessage << std::endl;
+        return false;
+    }
+    currentFile.close();
+
+    current.assign(matrixCSR.nodeNum.size(), 0);
+    for (unsigned long long int i = 0; i < currentNode.size(); i++)
+    {
+        long long int row = matrixCSR.findRow(currentNode[i]);
+        if (row == -1)
+        {
+            std::cout << "Unknown Node in Current File: " << currentNode[i] << std::endl;
+            return false;
+        }
+        current[row] += std::complex<double>((double)currentValue[i * 2], (double)currentValue[i * 2 + 1]);
+    }
+
+    return true;
+}
+
+/* solveVoltage() 함수
+*
+* 기능: 각 node에 주입되는 전류 I를 파일에서 읽어, Y V = I를 풀어 각 node의 전압을 CSV 형식(node,V_real,V_imag)으로 출력한다.
+*       분석, 분해, 대입에 걸린 시간은 표준 오류로 출력한다.
+* 입력값: matrixCSR, currentPath(전류 파일의 위치), writer
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool solveVoltage(const Y_Matrix_CSR& matrixCSR, const std::string& currentPath, Output_Writer& writer)
+{
+    std::vector<std::complex<double>> voltage;
+
+    // 전류 파일 읽기
+    if (!readCurrentFile(matrixCSR, currentPath, voltage))
+    {
+        return false;
+    }
+
+    // Y-Matrix 분해
+    Sparse_LU<std::complex<double>> matrixLU;
+    double analyzeTime, factorTime;
+    std::string errorMessage;
+    if (!factorMatrix(matrixCSR, matrixLU, analyzeTime, factorTime, errorMessage))
+    {
+        std::cout << errorMessage << std::endl;
+        return false;
+    }
+
+    // Y V = I 풀기
+    auto startTime = std::chrono::steady_clock::now();
+    matrixLU.solve(voltage);
+    double solveTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    // 전압 출력
+    writer.writeText("node,V_real,V_imag\n");
+    for (unsigned long long int row = 0; row < matrixCSR.nodeNum.size(); row++)
+    {
+        writer.writeInt(matrixCSR.nodeNum[row]);
+        writer.writeChar(',');
+        writer.writeReal(voltage[row].real());
+        writer.writeChar(',');
+        writer.writeReal(voltage[row].imag());
+        writer.writeChar('\n');
+    }
+
+    std::cerr << "Nodes: " << matrixCSR.nodeNum.size() << ", Nonzeros: " << matrixCSR.colIdx.size() << ", LU Nonzeros: " << matrixLU.factorNonzeros() << std::endl;
+    std::cerr << std::fixed << std::setprecision(3) << "Analyze: " << analyzeTime << " ms, Factor: " << factorTime << " ms, Solve: " << solveTime << " ms" << std::endl;
+
+    return true;
+}
+
+// 전력 조류 계산의 수렴 조건(최대 전력 오차, pu)과 최대 반복 횟수
+const double POWER_FLOW_TOLERANCE = 1e-8;
+const int POWER_FLOW_MAX_ITERATION = 30;
+
+/* parseBusFile() 함수
+*
+* 기능: 모선 파일의 내용을 한 줄씩 읽어, (Node) (종류) (P) (Q) (V) (위상각) 형식의 모선 정보를 bus vector에 추가한다.
+*       종류는 PQ, PV, SLACK 중 하나이며, 위상각의 단위는 도(degree)이다. 빈 줄은 무시한다.
+* 입력값: fileData, fileLength(읽을 내용과 길이), bus(모선 정보를 저장할 vector), errorMessage
+* 출력값: 모든 줄을 읽은 경우 참을, 형식에 맞지 않는 줄이 있는 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool parseBusFile(const char* fileData, unsigned long long int fileLength, std::vector<Bus_Val>& bus, std::string& errorMessage)
+{
+    const char* cursor = fileData;
+    const char* fileEnd = fileData + fileLength;
+    long long int lineNumber = 0;
+
+    while (cursor < fileEnd)
+    {
+        const char* lineEnd = (const char*)memchr(cursor, '\n', fileEnd - cursor);
+        if (lineEnd == NULL)
+        {
+            lineEnd = fileEnd;
+        }
+        lineNumber++;
+
+        // 줄을 빈칸 단위로 나눈다.
+        std::vector<std::string> field;
+        for (const char* fieldCursor = cursor; fieldCursor < lineEnd; )
+        {
+            while (fieldCursor < lineEnd && (*fieldCursor == ' ' || *fieldCursor == '\t' || *fieldCursor == '\r'))
+            {
+                fieldCursor++;
+            }
+            const char* fieldStart = fieldCursor;
+            while (fieldCursor < lineEnd && *fieldCursor != ' ' && *fieldCursor != '\t' && *fieldCursor != '\r')
+            {
+                fieldCursor++;
+            }
+            if (fieldCursor > fieldStart)
+            {
+                field.emplace_back(fieldStart, fieldCursor);
+            }
+        }
+
+        if (!field.empty())
+        {
+            Bus_Val busVal;
+            long double realVal[4];
+            bool isValid = (field.size() == 6);
+
+            // node 번호
+            if (isValid)
+            {
+                std::from_chars_result result = std::from_chars(field[0].data(), field[0].data() + field[0].size(), busVal.node);
+                isValid = (result.ec == std::errc() && result.ptr == field[0].data() + field[0].size());
+            }
+            // 모선 종류
+            if (isValid)
+            {
+                if (field[1] == "PQ" || field[1] == "pq")
+                {
+                    busVal.type = BUS_PQ;
+                }else if (field[1] == "PV" || field[1] == "pv")
+                {
+                    busVal.type = BUS_PV;
+                }else if (field[1] == "SLACK" || field[1] == "slack")
+                {
+                    busVal.type = BUS_SLACK;
+                }else{
+                    isValid = false;
+                }
+            }
+            // P, Q, V, 위상각
+            for (int i = 0; i < 4 && isValid; i++)
+            {
+                const char* fieldStart = skipPlusSign(field[i + 2].data(), field[i + 2].data() + field[i + 2].size());
+                std::from_chars_result result = parseRealValue(fieldStart, field[i + 2].data() + field[i + 2].size(), realVal[i]);
+                isValid = (result.ec == std::errc() && result.ptr == field[i + 2].data() + field[i + 2].size());
+            }
+
+            if (!isValid)
+            {
+                const char* textEnd = (lineEnd > cursor && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+                errorMessage = "Line " + std::to_string(lineNumber) + ": Invalid Format (" + std::string(cursor, textEnd) + ")";
+                return false;
+            }
+
+            busVal.P = realVal[0];
+            busVal.Q = realVal[1];
+            busVal.V = realVal[2];
+            busVal.theta = realVal[3] * 3.14159265358979323846L / 180;
+            bus.push_back(busVal);
+        }
+
+        cursor = lineEnd + 1;
+    }
+
+    return true;
+}
+
+/* runPowerFlow() 함수
+*
+* 기능: Y-Matrix와 모선 정보로 Newton-Raphson 방식의 전력 조류 계산을 한다. (극좌표 형식)
+*       Slack 모선이 아닌 모선의 위상각과 PQ 모선의 전압 크기를 변수로 하며,
+*       Jacobian은 Y-Matrix의 0이 아닌 값(G, jB)에서 바로 희소 행렬로 구성한다.
+*       Jacobian의 구조는 반복마다 같으므로, 구조 분석은 한 번만 하고 각 반복에서는 값만 다시 분해한다.
+*       모선 파일에 없는 node는 P = Q = 0인 PQ 모선으로 한다.
+* 입력값: matrixCSR, bus(모선 정보, 결과 전압과 전력도 이곳에 저장한다), iterationCount(반복 횟수를 저장할 변수), iterationTime(반복별 걸린 시간(ms)을 저장할 vector), errorMessage
+* 출력값: 수렴 여부
+* 최종 수정일: 2026/10/17
+*/
+bool runPowerFlow(const Y_Matrix_CSR& matrixCSR, std::vector<Bus_Val>& bus, int& iterationCount, std::vector<double>& iterationTime, std::string& errorMessage)
+{
+    long long int busCount = matrixCSR.nodeNum.size();
+    std::vector<int> busType(busCount, BUS_PQ);
+    std::vector<double> Pspec(busCount, 0), Qspec(busCount, 0), V(busCount, 1), theta(busCount, 0);
+    std::vector<long long int> busRow(bus.size());
+    bool hasSlack = false;
+
+    iterationCount = 0;
+    iterationTime.clear();
+
+    // 모선 정보를 Y-Matrix의 행 순서로 정리한다.
+    for (unsigned long long int i = 0; i < bus.size(); i++)
+    {
+        long long int row = matrixCSR.findRow(bus[i].node);
+        if (row == -1)
+        {
+            errorMessage = "Unknown Node in Bus File: " + std::to_string(bus[i].node);
+            return false;
+        }
+        busRow[i] = row;
+        busType[row] = bus[i].type;
+        Pspec[row] = bus[i].P;
+        Qspec[row] = bus[i].Q;
+        if (bus[i].type != BUS_PQ)
+        {
+            V[row] = bus[i].V;
+        }
+        if (bus[i].type == BUS_SLACK)
+        {
+            theta[row] = bus[i].theta;
+            hasSlack = true;
+        }
+    }
+    if (!hasSlack)
+    {
+        errorMessage = "No Slack Bus";
+        return false;
+    }
+
+    // 변수의 위치를 정한다. (Slack이 아닌 모선의 위상각, PQ 모선의 전압 크기 순서)
+    std::vector<long long int> thetaIndex(busCount, -1), voltageIndex(busCount, -1);
+    long long int variableCount = 0;
+    for (long long int i = 0; i < busCount; i++)
+    {
+        if (busType[i] != BUS_SLACK)
+        {
+            thetaIndex[i] = variableCount++;
+        }
+    }
+    for (long long int i = 0; i < busCount; i++)
+    {
+        if (busType[i] == BUS_PQ)
+        {
+            voltageIndex[i] = variableCount++;
+        }
+    }
+
+    // Jacobian의 구조를 만든다. (P, Q 식의 행에 대해, Y-Matrix의 같은 행에 있는 모선의 위상각, 전압 크기 열)
+    std::vector<long long int> jacobianRowPtr(variableCount + 1, 0), jacobianColIdx;
+    std::vector<long long int> equationBus(variableCount);
+    for (long long int i = 0; i < busCount; i++)
+    {
+        if (thetaIndex[i] != -1)
+        {
+            equationBus[thetaIndex[i]] = i;
+        }
+        if (voltageIndex[i] != -1)
+        {
+            equationBus[voltageIndex[i]] = i;
+        }
+    }
+    for (long long int equation = 0; equation < variableCount; equation++)
+    {
+        long long int i = equationBus[equation];
+        for (long long int cursor = matrixCSR.rowPtr[i]; cursor < matrixCSR.rowPtr[i + 1]; cursor++)
+        {
+            long long int k = matrixCSR.colIdx[cursor];
+            if (thetaIndex[k] != -1)
+            {
+                jacobianColIdx.push_back(thetaIndex[k]);
+            }
+            if (voltageIndex[k] != -1)
+            {
+                jacobianColIdx.push_back(voltageIndex[k]);
+            }
+        }
+        jacobianRowPtr[equation + 1] = jacobianColIdx.size();
+    }
+
+    Sparse_LU<double> jacobianLU;
+    if (!jacobianLU.analyze(variableCount, jacobianRowPtr, jacobianColIdx))
+    {
+        errorMessage = "Invalid Jacobian Structure";
+        return false;
+    }
+
+    std::vector<double> P(busCount), Q(busCount), mismatch(variableCount), jacobianValue(jacobianColIdx.size());
+    bool isConverged = false;
+
+    for (iterationCount = 0; ; iterationCount++)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+
+        // 각 모선의 주입 전력을 계산한다.
+        for (long long int i = 0; i < busCount; i++)
+        {
+            double sumP = 0, sumQ = 0;
+            for (long long int cursor = matrixCSR.rowPtr[i]; cursor < matrixCSR.rowPtr[i + 1]; cursor++)
+            {
+                long long int k = matrixCSR.colIdx[cursor];
+                double G = matrixCSR.G[cursor], B = matrixCSR.jB[cursor];
+                double angle = theta[i] - theta[k];
+                sumP += V[k] * (G * cos(angle) + B * sin(angle));
+                sumQ += V[k] * (G * sin(angle) - B * cos(angle));
+            }
+            P[i] = V[i] * sumP;
+            Q[i] = V[i] * sumQ;
+        }
+
+        // 전력 오차를 계산하고, 수렴 여부를 확인한다.
+        double maxMismatch = 0;
+        for (long long int i = 0; i < busCount; i++)
+        {
+            if (thetaIndex[i] != -1)
+            {
+                mismatch[thetaIndex[i]] = Pspec[i] - P[i];
+                maxMismatch = std::max(maxMismatch, fabs(Pspec[i] - P[i]));
+            }
+            if (voltageIndex[i] != -1)
+            {
+                mismatch[voltageIndex[i]] = Qspec[i] - Q[i];
+                maxMismatch = std::max(maxMismatch, fabs(Qspec[i] - Q[i]));
+            }
+        }
+        if (maxMismatch < POWER_FLOW_TOLERANCE)
+        {
+            isConverged = true;
+            break;
+        }
+        if (iterationCount == POWER_FLOW_MAX_ITERATION || std::isnan(maxMismatch))
+        {
+            break;
+        }
+
+        // Jacobian의 값을 계산한다.
+        long long int jacobianCursor = 0;
+        for (long long int equation = 0; equation < variableCount; equation++)
+        {
+            long long int i = equationBus[equation];
+            bool isPEquation = (equation == thetaIndex[i]);
+
+            for (long long int cursor = matrixCSR.rowPtr[i]; cursor < matrixCSR.rowPtr[i + 1]; cursor++)
+            {
+                long long int k = matrixCSR.colIdx[cursor];
+                double G = matrixCSR.G[cursor], B = matrixCSR.jB[cursor];
+                double dTheta, dVoltage; // 위상각, 전압 크기에 대한 편미분
+
+                if (k == i)
+                {
+                    if (isPEquation)
+                    {
+                        dTheta = -Q[i] - B * V[i] * V[i];
+                        dVoltage = P[i] / V[i] + G * V[i];
+                    }else{
+                        dTheta = P[i] - G * V[i] * V[i];
+                        dVoltage = Q[i] / V[i] - B * V[i];
+                    }
+                }else{
+                    double angle = theta[i] - theta[k];
+                    double cosTerm = G * cos(angle) + B * sin(angle), sinTerm = G * sin(angle) - B * cos(angle);
+                    if (isPEquation)
+                    {
+                        dTheta = V[i] * V[k] * sinTerm;
+                        dVoltage = V[i] * cosTerm;
+                    }else{
+                        dTheta = -V[i] * V[k] * cosTerm;
+                        dVoltage = V[i] * sinTerm;
+                    }
+                }
+
+                if (thetaIndex[k] != -1)
+                {
+                    jacobianValue[jacobianCursor++] = dTheta;
+                }
+                if (voltageIndex[k] != -1)
+                {
+                    jacobianValue[jacobianCursor++] = dVoltage;
+                }
+            }
+        }
+
+        // J Δx = 전력 오차를 풀어, 위상각과 전압 크기를 수정한다.
+        if (!jacobianLU.factor(jacobianValue))
+        {
+            errorMessage = "Singular Jacobian - Pivot Too Small at Bus " + std::to_string(matrixCSR.nodeNum[equationBus[jacobianLU.failedPivot()]]);
+            return false;
+        }
+        jacobianLU.solve(mismatch);
+        for (long long int i = 0; i < busCount; i++)
+        {
+            if (thetaIndex[i] != -1)
+            {
+                theta[i] += mismatch[thetaIndex[i]];
+            }
+            if (voltageIndex[i] != -1)
+            {
+                V[i] += mismatch[voltageIndex[i]];
+            }
+        }
+
+        iterationTime.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+    }
+
+    // 결과를 모선 정보에 저장한다. (모선 파일에 없던 모선도 추가한다.)
+    std::vector<bool> isListed(busCount, false);
+    for (unsigned long long int i = 0; i < bus.size(); i++)
+    {
+        isListed[busRow[i]] = true;
+    }
+    for (long long int i = 0; i < busCount; i++)
+    {
+        if (!isListed[i])
+        {
+            Bus_Val busVal = { matrixCSR.nodeNum[i], BUS_PQ, 0, 0, 1, 0 };
+            bus.push_back(busVal);
+        }
+    }
+    for (unsigned long long int i = 0; i < bus.size(); i++)
+    {
+        long long int row = matrixCSR.findRow(bus[i].node);
+        bus[i].P = P[row];
+        bus[i].Q = Q[row];
+        bus[i].V = V[row];
+        bus[i].theta = theta[row];
+    }
+    std::sort(bus.begin(), bus.end(), [](const Bus_Val& a, const Bus_Val& b) { return a.node < b.node; });
+
+    if (!isConverged)
+    {
+        errorMessage = "Power Flow Did Not Converge";
+    }
+
+    return isConverged;
+}
+
+/* solvePowerFlow() 함수
+*
+* 기능: 모선 파일을 읽어 전력 조류 계산을 하고, 각 모선의 결과를 CSV 형식(node,type,V,theta_deg,P,Q)으로 출력한다.
+*       반복 횟수와 반복별 걸린 시간은 표준 오류로 출력한다.
+* 입력값: matrixCSR, busPath(모선 파일의 위치), writer
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool solvePowerFlow(const Y_Matrix_CSR& matrixCSR, const std::string& busPath, Output_Writer& writer)
+{
+    Mapped_File busFile;
+    std::vector<Bus_Val> bus;
+    std::vector<double> iterationTime;
+    std::string errorMessage;
+    int iterationCount = 0;
+
+    // 모선 파일 읽기
+    if (!busFile.open(busPath))
+    {
+        std::cout << "Bus File Not Found" << std::endl;
+        return false;
+    }
+    if (!parseBusFile(busFile.data(), busFile.size(), bus, errorMessage))
+    {
+        std::cout << "Invalid Bus File - " << errorMessage << std::endl;
+        return false;
+    }
+    busFile.close();
+
+    // 전력 조류 계산
+    bool isConverged = runPowerFlow(matrixCSR, bus, iterationCount, iterationTime, errorMessage);
+
+    // 반복 횟수와 반복별 걸린 시간 출력
+    double totalTime = 0;
+    for (unsigned long long int i = 0; i < iterationTime.size(); i++)
+    {
+        std::cerr << "Iteration " << i + 1 << ": " << std::fixed << std::setprecision(3) << iterationTime[i] << " ms" << std::endl;
+        totalTime += iterationTime[i];
+    }
+    std::cerr << "Iterations: " << iterationCount << ", Average: " << std::fixed << std::setprecision(3) << (iterationTime.empty() ? 0 : totalTime / iterationTime.size()) << " ms/iteration" << std::endl;
+
+    if (!isConverged)
+    {
+        std::cout << errorMessage << std::endl;
+        return false;
+    }
+
+    // 결과 출력
+    writer.writeText("node,type,V,theta_deg,P,Q\n");
+    for (unsigned long long int i = 0; i < bus.size(); i++)
+    {
+        writer.writeInt(bus[i].node);
+        writer.writeText(bus[i].type == BUS_SLACK ? ",SLACK," : bus[i].type == BUS_PV ? ",PV," : ",PQ,");
+        writer.writeReal((double)bus[i].V);
+        writer.writeChar(',');
+        writer.writeReal((double)(bus[i].theta * 180 / 3.14159265358979323846L));
+        writer.writeChar(',');
+        writer.writeReal((double)bus[i].P);
+        writer.writeChar(',');
+        writer.writeReal((double)bus[i].Q);
+        writer.writeChar('\n');
+    }
+
+    return true;
+}
+
+/* analyzeContingency() 함수
+*
+* 기능: 기본 계통의 LU 분해 결과를 다시 사용하여, 각 선로가 하나씩 빠졌을 때(N-1)의 전압을 계산하고 전압 범위 위반을 찾는다.
+*       선로 (a, b)가 빠지면 Y-Matrix는 a, b의 행과 열만 바뀌므로(ΔY = E M E^T, E = [e_a e_b]), Woodbury 공식으로
+*       V' = V - Z_E (I + M Z_EE)^(-1) M V_E 를 계산한다. (Z_E = Y^(-1) E)
+*       따라서 사고마다 다시 분해하지 않고, 두 번의 대입과 2x2 행렬 계산만 한다.
+*       선로 충전 용량이 없으면 ΔY = -y u u^T (u = e_a - e_b)로 rank 1이므로, Sherman-Morrison 공식으로
+*       V' = V + z y (V_a - V_b) / (1 - y (z_a - z_b)) (z = Y^(-1) u)를 계산하여 한 번의 대입만 한다.
+*       I + M Z_EE(rank 1의 경우 1 - y (z_a - z_b))가 특이한 경우, 선로가 빠지면 계통이 분리되는 것으로 판단한다.
+*       사고는 여러 thread가 나누어 계산한다.
+* 입력값: matrixCSR, matrixLU(분해된 기본 계통의 Y-Matrix), baseVoltage(기본 계통의 전압), branch(선로 정보),
+*         threadCount, minVoltage, maxVoltage(전압 크기의 허용 범위)
+* 출력값: 각 선로의 사고 계산 결과(자기 자신과 연결된 선로는 제외)
+* 최종 수정일: 2026/10/17
+*/
+std::vector<Contingency_Result> analyzeContingency(const Y_Matrix_CSR& matrixCSR, const Sparse_LU<std::complex<double>>& matrixLU, const std::vector<std::complex<double>>& baseVoltage,
+    const std::vector<Branch_Val>& branch, int threadCount, double minVoltage, double maxVoltage)
+{
+    long long int busCount = matrixCSR.nodeNum.size();
+    std::vector<Contingency_Result> result(branch.size());
+    std::vector<char> isComputed(branch.size(), false); // 여러 thread가 동시에 기록하므로, bit 단위로 묶지 않는다.
+    std::atomic<unsigned long long int> nextBranch(0);
+    std::vector<std::thread> worker;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        worker.emplace_back([&]() {
+            // thread마다 계산에 사용할 공간
+            std::vector<std::complex<double>> columnA(busCount), columnB(busCount), work(busCount);
+
+            // 다음으로 계산할 선로를 차례대로 가져온다.
+            for (unsigned long long int index = nextBranch++; index < branch.size(); index = nextBranch++)
+            {
+                long long int a = matrixCSR.findRow(branch[index].node1), b = matrixCSR.findRow(branch[index].node2);
+                if (a == -1 || b == -1 || a == b)
+                {
+                    continue;
+                }
+
+                // 빠지는 선로의 직렬 어드미턴스와 양 끝의 충전 어드미턴스
+                std::complex<double> seriesY((double)RealValCalc(branch[index].R, branch[index].L), (double)ImagValCalc(branch[index].R, branch[index].L));
+                std::complex<double> shuntY(0, (double)(branch[index].C / 2));
+
+                Contingency_Result& contingency = result[index];
+                contingency.branchIndex = index;
+                contingency.isIslanded = false;
+                contingency.violationCount = 0;
+                contingency.worstNode = -1;
+                contingency.worstVoltage = 0;
+                contingency.severity = 0;
+                isComputed[index] = true;
+
+                // 각 node의 전압 크기로 범위를 확인한다.
+                double worstExcess = 0;
+                auto checkVoltage = [&](long long int i, double magnitude) {
+                    double excess = magnitude > maxVoltage ? magnitude - maxVoltage : magnitude < minVoltage ? minVoltage - magnitude : 0;
+
+                    if (excess > 0)
+                    {
+                        contingency.violationCount++;
+                        contingency.severity += excess;
+                        if (excess > worstExcess)
+                        {
+                            worstExcess = excess;
+                            contingency.worstNode = matrixCSR.nodeNum[i];
+                            contingency.worstVoltage = magnitude;
+                        }
+                    }
+                };
+
+                // 선로 충전 용량이 없는 경우(rank 1): z = Y^(-1) (e_a - e_b)
+                if (shuntY == std::complex<double>(0))
+                {
+                    std::fill(columnA.begin(), columnA.end(), 0);
+                    columnA[a] = 1;
+                    columnA[b] = -1;
+                    matrixLU.solve(columnA, work);
+
+                    std::complex<double> yz = seriesY * (columnA[a] - columnA[b]);
+                    std::complex<double> denominator = 1.0 - yz;
+                    if (std::abs(denominator) < 1e-10 * std::max(1.0, std::abs(yz)))
+                    {
+                        contingency.isIslanded = true;
+                        contingency.severity = INFINITY;
+                        continue;
+                    }
+
+                    // V' = V + z coefficient
+                    std::complex<double> coefficient = seriesY * (baseVoltage[a] - baseVoltage[b]) / denominator;
+                    for (long long int i = 0; i < busCount; i++)
+                    {
+                        checkVoltage(i, std::abs(baseVoltage[i] + columnA[i] * coefficient));
+                    }
+                    continue;
+                }
+
+                // ΔY = E M E^T
+                std::complex<double> M[2][2] = { { -(seriesY + shuntY), seriesY }, { seriesY, -(seriesY + shuntY) } };
+
+                // Z_E = Y^(-1) [e_a e_b]
+                std::fill(columnA.begin(), columnA.end(), 0);
+                std::fill(columnB.begin(), columnB.end(), 0);
+                columnA[a] = 1;
+                columnB[b] = 1;
+                matrixLU.solve(columnA, work);
+                matrixLU.solve(columnB, work);
+
+                // S = I + M Z_EE
+                std::complex<double> Zee[2][2] = { { columnA[a], columnB[a] }, { columnA[b], columnB[b] } };
+                std::complex<double> S[2][2];
+                for (int i = 0; i < 2; i++)
+                {
+                    for (int j = 0; j < 2; j++)
+                    {
+                        S[i][j] = (i == j ? 1.0 : 0.0) + M[i][0] * Zee[0][j] + M[i][1] * Zee[1][j];
+                    }
+                }
+                std::complex<double> determinant = S[0][0] * S[1][1] - S[0][1] * S[1][0];
+
+                // 계통 분리 여부 확인
+                double scale = std::max({ 1.0, std::abs(S[0][0]) * std::abs(S[1][1]), std::abs(S[0][1]) * std::abs(S[1][0]) });
+                if (std::abs(determinant) < 1e-10 * scale)
+                {
+                    contingency.isIslanded = true;
+                    contingency.severity = INFINITY;
+                    continue;
+                }
+
+                // coefficient = S^(-1) M V_E
+                std::complex<double> MV[2] = { M[0][0] * baseVoltage[a] + M[0][1] * baseVoltage[b], M[1][0] * baseVoltage[a] + M[1][1] * baseVoltage[b] };
+                std::complex<double> coefficient[2] = { (S[1][1] * MV[0] - S[0][1] * MV[1]) / determinant, (S[0][0] * MV[1] - S[1][0] * MV[0]) / determinant };
+
+                // V' = V - Z_E coefficient 로 각 node의 전압을 구해 범위를 확인한다.
+                for (long long int i = 0; i < busCount; i++)
+                {
+                    checkVoltage(i, std::abs(baseVoltage[i] - columnA[i] * coefficient[0] - columnB[i] * coefficient[1]));
+                }
+            }
+        });
+    }
+    for (int t = 0; t < threadCount; t++)
+    {
+        worker[t].join();
+    }
+
+    // 계산하지 않은 선로를 제외하고, 심각한 순서(계통 분리, 위반 정도의 합)로 정렬한다.
+    std::vector<Contingency_Result> ranking;
+    for (unsigned long long int i = 0; i < branch.size(); i++)
+    {
+        if (isComputed[i])
+        {
+            ranking.push_back(result[i]);
+        }
+    }
+    std::stable_sort(ranking.begin(), ranking.end(), [](const Contingency_Result& x, const Contingency_Result& y) {
+        return x.severity > y.severity;
+    });
+
+    return ranking;
+}
+
+/* solveContingency() 함수
+*
+* 기능: 전류 파일로 기본 계통의 전압을 구한 뒤, 각 선로의 상정 사고(N-1)를 계산하여 심각한 순서로 CSV 형식
+*       (rank,branch,node1,node2,status,violations,worst_node,worst_V,severity)으로 출력한다. branch는 입력 파일에서 선로의 순서(1부터)이다.
+*       걸린 시간은 표준 오류로 출력한다.
+* 입력값: matrixCSR, branch, currentPath(전류 파일의 위치), threadCount, minVoltage, maxVoltage, writer
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool solveContingency(const Y_Matrix_CSR& matrixCSR, const std::vector<Branch_Val>& branch, const std::string& currentPath, int threadCount, double minVoltage, double maxVoltage, Output_Writer& writer)
+{
+    std::vector<std::complex<double>> voltage;
+
+    // 기본 계통의 전압 계산
+    if (!readCurrentFile(matrixCSR, currentPath, voltage))
+    {
+        return false;
+    }
+    Sparse_LU<std::complex<double>> matrixLU;
+    double analyzeTime, factorTime;
+    std::string errorMessage;
+    if (!factorMatrix(matrixCSR, matrixLU, analyzeTime, factorTime, errorMessage))
+    {
+        std::cout << errorMessage << std::endl;
+        return false;
+    }
+    matrixLU.solve(voltage);
+
+    // 상정 사고 계산
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<Contingency_Result> ranking = analyzeContingency(matrixCSR, matrixLU, voltage, branch, threadCount, minVoltage, maxVoltage);
+    double contingencyTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    // 결과 출력
+    writer.writeText("rank,branch,node1,node2,status,violations,worst_node,worst_V,severity\n");
+    for (unsigned long long int i = 0; i < ranking.size(); i++)
+    {
+        const Branch_Val& branchVal = branch[ranking[i].branchIndex];
+
+        writer.writeInt(i + 1);
+        writer.writeChar(',');
+        writer.writeInt(ranking[i].branchIndex + 1);
+        writer.writeChar(',');
+        writer.writeInt(branchVal.node1);
+        writer.writeChar(',');
+        writer.writeInt(branchVal.node2);
+        if (ranking[i].isIslanded)
+        {
+            writer.writeText(",ISLANDED,,,,\n");
+            continue;
+        }
+        writer.writeText(ranking[i].violationCount > 0 ? ",VIOLATION," : ",OK,");
+        writer.writeInt(ranking[i].violationCount);
+        writer.writeChar(',');
+        if (ranking[i].violationCount > 0)
+        {
+            writer.writeInt(ranking[i].worstNode);
+            writer.writeChar(',');
+            writer.writeReal(ranking[i].worstVoltage);
+        }else{
+            writer.writeChar(',');
+        }
+        writer.writeChar(',');
+        writer.writeReal(ranking[i].severity);
+        writer.writeChar('\n');
+    }
+
+    std::cerr << std::fixed << std::setprecision(3) << "Analyze: " << analyzeTime << " ms, Factor: " << factorTime << " ms" << std::endl;
+    std::cerr << "Contingencies: " << ranking.size() << ", Threads: " << threadCount << ", Time: " << contingencyTime << " ms ("
+        << (ranking.empty() ? 0 : contingencyTime / ranking.size()) << " ms/contingency)" << std::endl;
+
+    return true;
+}
+
+/* reduceKron() 함수
+*
+* 기능: 남길 node(K)를 제외한 node(E)를 Gauss 소거하여, Kron 축약한 Y-Matrix(Y_KK - Y_KE Y_EE^(-1) Y_EK)를 구한다.
+*       소거할 node는 남은 연결이 가장 적은 node부터 하나씩 소거하며(최소 차수 순서, 차수가 같은 경우 행 번호 순서),
+*       node p를 소거할 때 p와 연결된 node i, j에 대해 Y_ij -= Y_ip Y_pj / Y_pp 를 계산한다. 연결되어 있지 않던 (i, j)는 새 값(fill-in)으로 추가한다.
+*       대칭이 아닌 값도 그대로 계산하며, 계산 결과가 정확히 0이 된 값은 저장하지 않는다.
+* 입력값: matrixCSR, keepNode(남길 node 번호, 오름차순), reducedCSR(축약한 Y-Matrix를 저장할 변수), fillCount(추가된 대각 성분이 아닌 값의 수를 저장할 변수)
+* 출력값: 성공 여부(소거할 node의 대각 성분이 0이 되는 경우 거짓)
+* 최종 수정일: 2026/10/17
+*/
+bool reduceKron(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& keepNode, Y_Matrix_CSR& reducedCSR, long long int& fillCount)
+{
+    long long int nodeCount = matrixCSR.nodeNum.size();
+    std::vector<char> isKept(nodeCount, false), isEliminated(nodeCount, false);
+    std::vector<std::vector<Y_Matrix_Val<>>> rowEntry(nodeCount); // 각 행의 값(node1은 행, node2는 열의 위치)
+    std::vector<long long int> position(nodeCount, -1); // 현재 행에서 각 열의 값이 저장된 위치
+
+    fillCount = 0;
+    for (long long int Node : keepNode)
+    {
+        long long int row = matrixCSR.findRow(Node);
+        if (row != -1)
+        {
+            isKept[row] = true;
+        }
+    }
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+        {
+            rowEntry[row].push_back({ row, matrixCSR.colIdx[cursor], matrixCSR.G[cursor], matrixCSR.jB[cursor] });
+        }
+    }
+
+    // 소거할 node를 차수 순서로 꺼낸다. (차수가 바뀐 경우 다시 넣고, 꺼낼 때 바뀌기 전의 값은 무시한다.)
+    std::priority_queue<std::pair<long long int, long long int>, std::vector<std::pair<long long int, long long int>>, std::greater<std::pair<long long int, long long int>>> degreeQueue;
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        if (!isKept[row])
+        {
+            degreeQueue.push({ (long long int)rowEntry[row].size(), row });
+        }
+    }
+    while (!degreeQueue.empty())
+    {
+        long long int queuedDegree = degreeQueue.top().first, pivot = degreeQueue.top().second;
+        degreeQueue.pop();
+        if (isEliminated[pivot] || queuedDegree != (long long int)rowEntry[pivot].size())
+        {
+            continue;
+        }
+        isEliminated[pivot] = true;
+
+        // 1 / Y_pp 를 구한다.
+        std::vector<Y_Matrix_Val<>>& pivotRow = rowEntry[pivot];
+        long double pivotG = 0, pivotB = 0;
+        for (const Y_Matrix_Val<>& entry : pivotRow)
+        {
+            if (entry.node2 == pivot)
+            {
+                pivotG = entry.G;
+                pivotB = entry.jB;
+            }
+        }
+        long double pivotSize = pivotG * pivotG + pivotB * pivotB;
+        if (pivotSize == 0)
+        {
+            return false;
+        }
+        long double inverseG = pivotG / pivotSize, inverseB = (-1) * pivotB / pivotSize;
+
+        for (const Y_Matrix_Val<>& rowVal : pivotRow)
+        {
+            long long int row = rowVal.node2;
+            if (row == pivot)
+            {
+                continue;
+            }
+
+            // 행 i의 값 위치를 기록하고, Y_ip를 읽은 뒤 행 i에서 지운다.
+            std::vector<Y_Matrix_Val<>>& targetRow = rowEntry[row];
+            long double multiplierG = 0, multiplierB = 0;
+            for (unsigned long long int i = 0; i < targetRow.size(); i++)
+            {
+                if (targetRow[i].node2 == pivot)
+                {
+                    // m = Y_ip / Y_pp
+                    multiplierG = targetRow[i].G * inverseG - targetRow[i].jB * inverseB;
+                    multiplierB = targetRow[i].G * inverseB + targetRow[i].jB * inverseG;
+                    targetRow[i] = targetRow.back();
+                    targetRow.pop_back();
+                    break;
+                }
+            }
+            for (unsigned long long int i = 0; i < targetRow.size(); i++)
+            {
+                position[targetRow[i].node2] = i;
+            }
+
+            // Y_ij -= m Y_pj
+            for (const Y_Matrix_Val<>& colVal : pivotRow)
+            {
+                long long int col = colVal.node2;
+                if (col == pivot)
+                {
+                    continue;
+                }
+                long double updateG = multiplierG * colVal.G - multiplierB * colVal.jB;
+                long double updateB = multiplierG * colVal.jB + multiplierB * colVal.G;
+                if (position[col] == -1)
+                {
+                    position[col] = targetRow.size();
+                    targetRow.push_back({ row, col, (-1) * updateG, (-1) * updateB });
+                    if (col != row)
+                    {
+                        fillCount++;
+                    }
+                }else{
+                    targetRow[position[col]].G -= updateG;
+                    targetRow[position[col]].jB -= updateB;
+                }
+            }
+
+            for (unsigned long long int i = 0; i < targetRow.size(); i++)
+            {
+                position[targetRow[i].node2] = -1;
+            }
+            if (!isKept[row])
+            {
+                degreeQueue.push({ (long long int)targetRow.size(), row });
+            }
+        }
+        std::vector<Y_Matrix_Val<>>().swap(pivotRow);
+    }
+
+    // 남은 행을 CSR 형태로 저장한다. (열 위치는 남긴 행의 순서로 바꾼다.)
+    std::vector<long long int> reducedRow(nodeCount, -1);
+    reducedCSR = Y_Matrix_CSR();
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        if (isKept[row])
+        {
+            reducedRow[row] = reducedCSR.nodeNum.size();
+            reducedCSR.nodeNum.push_back(matrixCSR.nodeNum[row]);
+        }
+    }
+    reducedCSR.rowPtr.push_back(0);
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        if (!isKept[row])
+        {
+            continue;
+        }
+        std::vector<Y_Matrix_Val<>>& targetRow = rowEntry[row];
+        std::sort(targetRow.begin(), targetRow.end(), [](const Y_Matrix_Val<>& a, const Y_Matrix_Val<>& b) {
+            return a.node2 < b.node2;
+        });
+        for (const Y_Matrix_Val<>& entry : targetRow)
+        {
+            if (entry.G != 0 || entry.jB != 0)
+            {
+                reducedCSR.colIdx.push_back(reducedRow[entry.node2]);
+                reducedCSR.G.push_back(entry.G);
+                reducedCSR.jB.push_back(entry.jB);
+            }
+        }
+        reducedCSR.rowPtr.push_back(reducedCSR.colIdx.size());
+        std::vector<Y_Matrix_Val<>>().swap(targetRow);
+    }
+
+    return true;
+}
+
+// 고장 후 전압을 저장하는 경우, thread 1개당 한 번에 계산하는 고장의 수
+const unsigned long long int FAULT_CHUNK_PER_THREAD = 8;
+
+/* solveFault() 함수
+*
+* 기능: Y-Matrix를 한 번 분해한 뒤, 각 고장 node k에 대해 Y z = e_k 를 풀어 Z-bus(Y^(-1))의 k번째 열만을 구하고,
+*       3상 단락(고장 임피던스 0) 시의 고장 전류 I_f = V_pre / Z_kk 와 고장 후 전압 V_i = V_pre - Z_ik I_f 를 계산한다.
+*       고장 전 전압 V_pre는 모든 node에서 1.0 pu로 한다.
+*       고장 전류는 CSV 형식(fault_node,Z_real,Z_imag,I_real,I_imag,I_mag)으로 출력하고, voltagePath가 주어진 경우
+*       고장 후 전압을 CSV 형식(fault_node,node,V_real,V_imag,V_mag)으로 저장한다. 걸린 시간은 표준 오류로 출력한다.
+*       고장은 여러 thread가 나누어 계산하며, 고장 후 전압을 저장하는 경우 (thread 수 * FAULT_CHUNK_PER_THREAD)개씩 계산한 뒤 순서대로 저장한다.
+* 입력값: matrixCSR, faultNode(고장 node 번호), threadCount, voltagePath(고장 후 전압을 저장할 파일, 빈 문자열이면 저장하지 않음), writer
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool solveFault(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& faultNode, int threadCount, const std::string& voltagePath, Output_Writer& writer)
+{
+    long long int busCount = matrixCSR.nodeNum.size();
+    std::vector<Fault_Result> result(faultNode.size());
+
+    for (unsigned long long int i = 0; i < faultNode.size(); i++)
+    {
+        result[i].node = faultNode[i];
+        result[i].row = matrixCSR.findRow(faultNode[i]);
+        if (result[i].row == -1)
+        {
+            std::cout << "Fault Node Not in Y-Matrix: " << faultNode[i] << std::endl;
+            return false;
+        }
+    }
+
+    // Y-Matrix 분해
+    Sparse_LU<std::complex<double>> matrixLU;
+    double analyzeTime, factorTime;
+    std::string errorMessage;
+    if (!factorMatrix(matrixCSR, matrixLU, analyzeTime, factorTime, errorMessage))
+    {
+        std::cout << errorMessage << std::endl;
+        return false;
+    }
+
+    // 고장 후 전압을 저장할 파일 열기
+    FILE* voltageFile = NULL;
+    if (!voltagePath.empty())
+    {
+        voltageFile = fopen(voltagePath.c_str(), "wb");
+        if (voltageFile == NULL)
+        {
+            std::cout << "Cannot Open Fault Voltage File" << std::endl;
+            return false;
+        }
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        std::unique_ptr<Output_Writer> voltageWriter; // 고장 후 전압을 저장하는 경우에만 만든다.
+        const std::complex<double> preVoltage(1.0, 0.0);
+        unsigned long long int chunkSize = voltageFile == NULL ? faultNode.size() : threadCount * FAULT_CHUNK_PER_THREAD;
+        std::vector<std::vector<std::complex<double>>> chunkColumn(voltageFile == NULL ? 0 : chunkSize);
+
+        if (voltageFile != NULL)
+        {
+            voltageWriter = std::make_unique<Output_Writer>(voltageFile);
+            voltageWriter->writeText("fault_node,node,V_real,V_imag,V_mag\n");
+        }
+        for (unsigned long long int chunkStart = 0; chunkStart < faultNode.size(); chunkStart += chunkSize)
+        {
+            unsigned long long int chunkEnd = std::min<unsigned long long int>(chunkStart + chunkSize, faultNode.size());
+            std::atomic<unsigned long long int> nextFault(chunkStart);
+            std::vector<std::thread> worker;
+
+            for (int t = 0; t < threadCount; t++)
+            {
+                worker.emplace_back([&]() {
+                    // thread마다 계산에 사용할 공간
+                    std::vector<std::complex<double>> column(busCount);
+
+                    // 다음으로 계산할 고장을 차례대로 가져온다.
+                    for (unsigned long long int index = nextFault++; index < chunkEnd; index = nextFault++)
+                    {
+                        // Z-bus의 k번째 열 = Y^(-1) e_k
+                        std::fill(column.begin(), column.end(), 0);
+                        column[result[index].row] = 1;
+                        matrixLU.solve(column);
+
+                        result[index].impedance = column[result[index].row];
+                        result[index].current = preVoltage / result[index].impedance;
+                        if (voltageFile != NULL)
+                        {
+                            chunkColumn[index - chunkStart].swap(column);
+                            column.resize(busCount);
+                        }
+                    }
+                });
+            }
+            for (int t = 0; t < threadCount; t++)
+            {
+                worker[t].join();
+            }
+
+            // 고장 후 전압을 고장 순서대로 저장한다.
+            for (unsigned long long int index = chunkStart; index < chunkEnd && voltageFile != NULL; index++)
+            {
+                const std::vector<std::complex<double>>& column = chunkColumn[index - chunkStart];
+                for (long long int i = 0; i < busCount; i++)
+                {
+                    std::complex<double> voltage = preVoltage - column[i] * result[index].current;
+
+                    voltageWriter->writeInt(result[index].node);
+                    voltageWriter->writeChar(',');
+                    voltageWriter->writeInt(matrixCSR.nodeNum[i]);
+                    voltageWriter->writeChar(',');
+                    voltageWriter->writeReal(voltage.real());
+                    voltageWriter->writeChar(',');
+                    voltageWriter->writeReal(voltage.imag());
+                    voltageWriter->writeChar(',');
+                    voltageWriter->writeReal(std::abs(voltage));
+                    voltageWriter->writeChar('\n');
+                }
+            }
+        }
+    }
+    double faultTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    if (voltageFile != NULL)
+    {
+        // 앞선 쓰기의 오류와 닫을 때의 오류를 모두 확인한다.
+        bool isWriteFailed = ferror(voltageFile) != 0;
+        if (fclose(voltageFile) != 0 || isWriteFailed)
+        {
+            std::cout << "Cannot Write Fault Voltage File" << std::endl;
+            return false;
+        }
+    }
+
+    // 고장 전류 출력
+    writer.writeText("fault_node,Z_real,Z_imag,I_real,I_imag,I_mag\n");
+    for (unsigned long long int i = 0; i < result.size(); i++)
+    {
+        writer.writeInt(result[i].node);
+        writer.writeChar(',');
+        writer.writeReal(result[i].impedance.real());
+        writer.writeChar(',');
+        writer.writeReal(result[i].impedance.imag());
+        writer.writeChar(',');
+        writer.writeReal(result[i].current.real());
+        writer.writeChar(',');
+        writer.writeReal(result[i].current.imag());
+        writer.writeChar(',');
+        writer.writeReal(std::abs(result[i].current));
+        writer.writeChar('\n');
+    }
+
+    std::cerr << std::fixed << std::setprecision(3) << "Analyze: " << analyzeTime << " ms, Factor: " << factorTime << " ms" << std::endl;
+    std::cerr << "Faults: " << result.size() << ", Threads: " << threadCount << ", Time: " << faultTime << " ms ("
+        << (result.empty() ? 0 : faultTime / result.size()) << " ms/fault)" << std::endl;
+
+    return true;
+}
@@ -0,0 +1,79 @@
+﻿/* analysis.hpp
+*
+* Y-Matrix를 사용하는 계산: 전압 계산(--solve), 전력 조류 계산(--powerflow), 상정 사고(--contingency), Kron 축약(--kron), 고장 계산(--fault)
+*/
+#ifndef Y_MATRIX_ANALYSIS_HPP
+#define Y_MATRIX_ANALYSIS_HPP
+
+#include<vector>
+#include<complex>
+#include<string>
+
+#include "io.hpp"
+#include "sparse_lu.hpp"
+
+/* Bus_Val 구조체
+ *
+ * 기능: 전력 조류 계산에 사용하는 모선(Bus)의 정보를 저장한다.
+ * 인수: node(모선 번호), type(모선 종류, BUS_PQ, BUS_PV, BUS_SLACK), P, Q(주입 유효, 무효전력 지정값), V, theta(전압 크기, 위상각(rad) 지정값)
+ * 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    long long int node;
+    int type;
+    long double P, Q, V, theta;
+}Bus_Val;
+
+// 모선 종류
+const int BUS_PQ = 1;
+const int BUS_PV = 2;
+const int BUS_SLACK = 3;
+
+/* Contingency_Result 구조체
+ *
+ * 기능: 선로 1개의 상정 사고(N-1) 계산 결과를 저장한다.
+ * 인수: branchIndex(선로의 위치), isIslanded(계통 분리 여부), violationCount(전압 범위를 벗어난 node 수),
+ *       worstNode, worstVoltage(범위를 가장 크게 벗어난 node와 그 전압 크기), severity(범위를 벗어난 정도의 합)
+ * 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    long long int branchIndex;
+    bool isIslanded;
+    long long int violationCount, worstNode;
+    double worstVoltage, severity;
+}Contingency_Result;
+
+/* Fault_Result 구조체
+ *
+ * 기능: 3상 단락 고장 계산의 결과를 저장한다.
+ * 인수: node(고장 node 번호), row(Y-Matrix에서의 행 위치), impedance(Z-bus의 대각 성분 Z_kk), current(고장 전류)
+ * 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    long long int node, row;
+    std::complex<double> impedance, current;
+}Fault_Result;
+
+bool readCurrentFile(const Y_Matrix_CSR& matrixCSR, const std::string& currentPath, std::vector<std::complex<double>>& current);
+
+bool solveVoltage(const Y_Matrix_CSR& matrixCSR, const std::string& currentPath, Output_Writer& writer);
+
+bool parseBusFile(const char* fileData, unsigned long long int fileLength, std::vector<Bus_Val>& bus, std::string& errorMessage);
+
+bool runPowerFlow(const Y_Matrix_CSR& matrixCSR, std::vector<Bus_Val>& bus, int& iterationCount, std::vector<double>& iterationTime, std::string& errorMessage);
+
+bool solvePowerFlow(const Y_Matrix_CSR& matrixCSR, const std::string& busPath, Output_Writer& writer);
+
+std::vector<Contingency_Result> analyzeContingency(const Y_Matrix_CSR& matrixCSR, const Sparse_LU<std::complex<double>>& matrixLU, const std::vector<std::complex<double>>& baseVoltage,
+    const std::vector<Branch_Val>& branch, int threadCount, double minVoltage, double maxVoltage);
+
+bool solveContingency(const Y_Matrix_CSR& matrixCSR, const std::vector<Branch_Val>& branch, const std::string& currentPath, int threadCount, double minVoltage, double maxVoltage, Output_Writer& writer);
+
+bool reduceKron(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& keepNode, Y_Matrix_CSR& reducedCSR, long long int& fillCount);
+
+bool solveFault(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& faultNode, int threadCount, const std::string& voltagePath, Output_Writer& writer);
+
+#endif // Y_MATRIX_ANALYSIS_HPP
@@ -0,0 +1,386 @@
+﻿#include<iostream>
+#include<iomanip>
+#include<chrono>
+#include<random>
+
+#include "bench.hpp"
+#include "spmv.hpp"
+
+/* benchmarkMultiply() 함수
+*
+* 기능: 구성한 Y-Matrix에 임의의 전압 K개(1, 4, 16, 64)를 곱하는 데 걸린 시간을 측정하여, 1회당 시간과 처리량(GFLOP/s)을 출력한다.
+*       복소수 곱셈과 덧셈 1번을 8 FLOP으로 계산하며, 각 K마다 0.2초 이상(최소 3회) 반복하여 평균을 구한다.
+* 입력값: matrixCSR, threadCount
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void benchmarkMultiply(const Y_Matrix_CSR& matrixCSR, int threadCount)
+{
+    // 난수 생성기(매 실행마다 같은 전압이 생성되도록 seed 고정)
+    std::mt19937_64 randomEngine(20241005);
+    std::uniform_real_distribution<double> valueDist(-1.0, 1.0);
+    const long long int rhsList[] = { 1, 4, 16, 64 };
+
+    auto buildStartTime = std::chrono::steady_clock::now();
+    Sparse_Multiplier multiplier(matrixCSR, threadCount);
+    double buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStartTime).count();
+
+    std::cout << "Nodes: " << multiplier.size() << ", Nonzeros: " << multiplier.nonzeroCount() << ", Threads: " << threadCount
+        << ", Setup: " << std::fixed << std::setprecision(3) << buildTime << " ms" << std::endl;
+    std::cout << std::setw(8) << "RHS" << std::setw(12) << "Calls" << std::setw(14) << "ms/Call" << std::setw(16) << "ns/Nonzero" << std::setw(12) << "GFLOP/s" << std::endl;
+
+    for (long long int rhsCount : rhsList)
+    {
+        std::vector<std::complex<double>> voltage(multiplier.size() * rhsCount), current(multiplier.size() * rhsCount);
+        for (std::complex<double>& V : voltage)
+        {
+            V = std::complex<double>(valueDist(randomEngine), valueDist(randomEngine));
+        }
+
+        // 첫 번째 계산은 측정하지 않는다. (cache, page 준비)
+        multiplier.multiply(voltage, current, rhsCount);
+
+        long long int callCount = 0;
+        double elapsedNs = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        while (callCount < 3 || elapsedNs < 2e8)
+        {
+            multiplier.multiply(voltage, current, rhsCount);
+            callCount++;
+            elapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+        }
+
+        double callNs = elapsedNs / callCount;
+        std::cout << std::setw(8) << rhsCount << std::setw(12) << callCount << std::setw(14) << std::setprecision(3) << callNs / 1e6
+            << std::setw(16) << std::setprecision(3) << callNs / ((double)multiplier.nonzeroCount() * rhsCount)
+            << std::setw(12) << std::setprecision(3) << 8.0 * multiplier.nonzeroCount() * rhsCount / callNs << std::endl;
+    }
+
+    return;
+}
+
+/* benchmarkBuild() 함수
+*
+* 기능: 선로 수를 2배씩 늘려가며 임의의 계통을 생성하고, Y-Matrix 구성에 걸린 시간을 측정해 출력한다.
+*       선로를 1개씩 추가하는 경우(addMatrixPackage)와 한 번에 추가하는 경우(addBranches)를 각각 측정한다.
+*       한 번에 추가하는 경우는 SIMD 묶음 계산을 사용하는 Y_Matrix<double, int32_t>로도 측정한다.
+*       선로 1개당 걸린 시간이 일정하면, 구성 시간이 선로 수에 비례함을 의미한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void benchmarkBuild()
+{
+    // 난수 생성기(매 실행마다 같은 계통이 생성되도록 seed 고정)
+    std::mt19937_64 randomEngine(20241005);
+    std::uniform_real_distribution<double> valueDist(0.001, 0.1);
+
+    std::cout << "Admittance Kernel: " << admittanceKernelName() << std::endl;
+    std::cout << std::setw(12) << "Branches" << std::setw(14) << "Time(ms)" << std::setw(16) << "ns/Branch" << std::setw(16) << "Bulk Time(ms)" << std::setw(16) << "Bulk ns/Branch" << std::setw(18) << "Double ns/Branch" << std::endl;
+
+    for (long long int branchCount = 12500; branchCount <= 800000; branchCount *= 2)
+    {
+        // node 수는 선로 수의 절반으로 하여, 고리 모양의 선로에 임의의 선로를 추가한 계통을 생성한다.
+        long long int nodeCount = branchCount / 2;
+        std::uniform_int_distribution<long long int> nodeDist(1, nodeCount);
+        std::vector<Branch_Val> branch(branchCount);
+
+        for (long long int i = 0; i < branchCount; i++)
+        {
+            branch[i].node1 = (i < nodeCount) ? i + 1 : nodeDist(randomEngine);
+            branch[i].node2 = (i < nodeCount) ? (i + 1) % nodeCount + 1 : nodeDist(randomEngine);
+            branch[i].R = valueDist(randomEngine);
+            branch[i].L = valueDist(randomEngine) * 10;
+            branch[i].C = 0.01;
+        }
+
+        // 선로 1개씩 추가하는 경우의 Y-Matrix 구성 시간 측정
+        Y_Matrix<> yMatrix;
+        auto startTime = std::chrono::steady_clock::now();
+        for (long long int i = 0; i < branchCount; i++)
+        {
+            yMatrix.addMatrixPackage(branch[i].node1, branch[i].node2, branch[i].R, branch[i].L, branch[i].C);
+        }
+        auto endTime = std::chrono::steady_clock::now();
+
+        // 모든 선로를 한 번에 추가하는 경우의 Y-Matrix 구성 시간 측정
+        Y_Matrix<> yMatrixBulk;
+        auto bulkStartTime = std::chrono::steady_clock::now();
+        yMatrixBulk.addBranches(branch);
+        auto bulkEndTime = std::chrono::steady_clock::now();
+
+        // double, 32bit node 번호로 한 번에 추가하는 경우의 Y-Matrix 구성 시간 측정
+        Y_Matrix<double, int32_t> yMatrixDouble;
+        auto doubleStartTime = std::chrono::steady_clock::now();
+        yMatrixDouble.addBranches(branch);
+        auto doubleEndTime = std::chrono::steady_clock::now();
+
+        double elapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+        double bulkElapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(bulkEndTime - bulkStartTime).count();
+        double doubleElapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(doubleEndTime - doubleStartTime).count();
+        std::cout << std::setw(12) << branchCount << std::setw(14) << std::fixed << std::setprecision(3) << elapsedNs / 1e6
+            << std::setw(16) << std::setprecision(1) << elapsedNs / branchCount
+            << std::setw(16) << std::setprecision(3) << bulkElapsedNs / 1e6
+            << std::setw(16) << std::setprecision(1) << bulkElapsedNs / branchCount
+            << std::setw(18) << std::setprecision(1) << doubleElapsedNs / branchCount << std::endl;
+    }
+
+    return;
+}
+
+// 생성하는 radial 계통에서 feeder 하나에 연결되는 node의 수
+const long long int RADIAL_FEEDER_LENGTH = 100;
+
+/* generateNetwork() 함수
+*
+* 기능: 주어진 형태와 선로 수의 임의의 계통을 생성한다. (매 실행마다 같은 계통이 생성되도록 seed 고정)
+*       radial: 1번 node(변전소)에서 시작하는 feeder가 RADIAL_FEEDER_LENGTH개씩의 node를 차례로 연결하며, 일부 node(20%)는 가까운 앞 node에서 갈라진다. (node 수 = 선로 수 + 1)
+*       mesh: 폭이 sqrt(선로 수 / 2)인 격자에 node를 행 순서로 추가하며, 왼쪽과 위쪽 node와 연결한다. (node 수 = 약 선로 수 / 2)
+*       random: node 수를 선로 수의 절반으로 하여, 고리 모양의 선로에 임의의 선로를 추가한다. (benchmarkBuild()와 같은 방식)
+*       선로의 R, L은 소숫점 아래 6자리까지의 임의의 값이며, C는 0.01이다.
+* 입력값: topology(radial, mesh, random), branchCount(선로 수)
+* 출력값: 생성한 선로 정보
+* 최종 수정일: 2026/10/17
+*/
+std::vector<Branch_Val> generateNetwork(const std::string& topology, long long int branchCount)
+{
+    std::mt19937_64 randomEngine(20241005);
+    std::uniform_real_distribution<double> valueDist(0.001, 0.1), lateralDist(0.0, 1.0);
+    std::vector<Branch_Val> branch;
+
+    branch.reserve(branchCount);
+    if (topology == "radial")
+    {
+        for (long long int Node = 2; (long long int)branch.size() < branchCount; Node++)
+        {
+            long long int parent = Node - 1;
+            if ((Node - 2) % RADIAL_FEEDER_LENGTH == 0)
+            {
+                parent = 1;
+            }else if (lateralDist(randomEngine) < 0.2)
+            {
+                parent = std::max(Node - 1 - (long long int)(randomEngine() % 5), (long long int)1);
+            }
+            branch.push_back({ parent, Node, 0, 0, 0.01 });
+        }
+    }else if (topology == "mesh")
+    {
+        long long int width = std::max((long long int)std::sqrt(branchCount / 2.0), (long long int)2);
+        for (long long int Node = 2; (long long int)branch.size() < branchCount; Node++)
+        {
+            if ((Node - 1) % width != 0)
+            {
+                branch.push_back({ Node - 1, Node, 0, 0, 0.01 });
+            }
+            if (Node > width && (long long int)branch.size() < branchCount)
+            {
+                branch.push_back({ Node - width, Node, 0, 0, 0.01 });
+            }
+        }
+    }else{
+        long long int nodeCount = std::max(branchCount / 2, (long long int)2);
+        std::uniform_int_distribution<long long int> nodeDist(1, nodeCount);
+        for (long long int i = 0; i < branchCount; i++)
+        {
+            if (i < nodeCount)
+            {
+                branch.push_back({ i + 1, (i + 1) % nodeCount + 1, 0, 0, 0.01 });
+            }else{
+                long long int node1 = nodeDist(randomEngine);
+                branch.push_back({ node1, nodeDist(randomEngine), 0, 0, 0.01 });
+            }
+        }
+    }
+
+    for (Branch_Val& branchVal : branch)
+    {
+        branchVal.R = std::round(valueDist(randomEngine) * 1e6) / 1e6;
+        branchVal.L = std::round(valueDist(randomEngine) * 1e7) / 1e6;
+    }
+
+    return branch;
+}
+
+/* writeBranchFile() 함수
+*
+* 기능: 선로 정보를 입력 파일 양식((Node1) (Node2) (R) (L) (C))으로 출력한다.
+* 입력값: branch, writer
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void writeBranchFile(const std::vector<Branch_Val>& branch, Output_Writer& writer)
+{
+    for (const Branch_Val& branchVal : branch)
+    {
+        writer.writeInt(branchVal.node1);
+        writer.writeChar(' ');
+        writer.writeInt(branchVal.node2);
+        writer.writeChar(' ');
+        writer.writeReal((double)branchVal.R);
+        writer.writeChar(' ');
+        writer.writeReal((double)branchVal.L);
+        writer.writeChar(' ');
+        writer.writeReal((double)branchVal.C);
+        writer.writeChar('\n');
+    }
+
+    return;
+}
+
+// 성능 측정에서, 선로 수가 적은 경우 반복하여 측정할 최소 선로 수(선로 수가 이보다 적으면 합이 이 수 이상이 되도록 반복한다.)
+const long long int SUITE_MIN_WORK = 100000;
+
+// 성능 측정에서, getMatrix()로 읽는 값의 수
+const long long int SUITE_LOOKUP_COUNT = 1000000;
+
+/* benchmarkSuite() 함수
+*
+* 기능: 주어진 형태마다 선로 수를 10부터 10배씩 maxBranchCount까지 늘려가며 계통을 생성하고, 각 단계에 걸린 시간을 CSV 형식으로 출력한다.
+*       parse: 입력 파일 양식의 문자열(memory에 저장)을 parseBranchFile()로 읽는 시간
+*       assembly: addMatrixPackage()로 선로를 1개씩 추가하여 Y-Matrix를 구성하는 시간, bulk: addBranches()로 한 번에 구성하는 시간
+*       lookup: 선로 양 끝 node의 위치(대각, 비대각 성분 각각 절반)를 getMatrix()로 SUITE_LOOKUP_COUNT번 읽을 때, 1회당 시간(ns)
+*       freeze: CSR 형태로 변환하는 시간, output: MatrixMarket 형식으로 임시 파일에 출력하는 시간
+*       선로 수가 SUITE_MIN_WORK보다 적은 경우, 여러 번(repeat) 반복하여 1회당 평균 시간을 구한다.
+* 입력값: topology(측정할 계통의 형태), maxBranchCount(최대 선로 수), writer
+* 출력값: 성공 여부(임시 파일을 만들 수 없는 경우 거짓)
+* 최종 수정일: 2026/10/17
+*/
+bool benchmarkSuite(const std::vector<std::string>& topology, long long int maxBranchCount, Output_Writer& writer)
+{
+    std::mt19937_64 randomEngine(20241005);
+
+    writer.writeText("topology,branches,nodes,nonzeros,file_bytes,repeat,parse_ms,assembly_ms,bulk_ms,lookup_ns,freeze_ms,output_ms\n");
+    for (const std::string& topologyName : topology)
+    {
+        for (long long int branchCount = 10; branchCount <= maxBranchCount; branchCount *= 10)
+        {
+            std::vector<Branch_Val> branch = generateNetwork(topologyName, branchCount);
+            long long int repeatCount = std::max(SUITE_MIN_WORK / branchCount, (long long int)1);
+
+            // 입력 파일 양식의 문자열을 만든다. (임시 파일에 출력한 뒤 다시 읽는다.)
+            std::vector<char> fileText;
+            {
+                FILE* textFile = std::tmpfile();
+                if (textFile == NULL)
+                {
+                    return false;
+                }
+                {
+                    Output_Writer textWriter(textFile);
+                    writeBranchFile(branch, textWriter);
+                }
+                fileText.resize(ftell(textFile));
+                rewind(textFile);
+                if (fread(fileText.data(), 1, fileText.size(), textFile) != fileText.size())
+                {
+                    fclose(textFile);
+                    return false;
+                }
+                fclose(textFile);
+            }
+
+            // parse
+            std::vector<Branch_Val> parsedBranch;
+            std::vector<long long int> busNum;
+            std::string errorMessage;
+            auto startTime = std::chrono::steady_clock::now();
+            for (long long int r = 0; r < repeatCount; r++)
+            {
+                parsedBranch.clear();
+                parseBranchFile(fileText.data(), fileText.size(), parsedBranch, errorMessage);
+                busNum = collectNodes(parsedBranch, std::vector<Device_Val>(), std::vector<long long int>());
+            }
+            double parseTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / repeatCount;
+
+            // assembly(addMatrixPackage, 마지막으로 구성한 Y-Matrix를 이후 단계에서 사용한다.)
+            Y_Matrix<> yMatrix;
+            startTime = std::chrono::steady_clock::now();
+            for (long long int r = 0; r < repeatCount; r++)
+            {
+                Y_Matrix<> yMatrixRepeat;
+                Y_Matrix<>& target = (r == repeatCount - 1) ? yMatrix : yMatrixRepeat;
+                for (const Branch_Val& branchVal : parsedBranch)
+                {
+                    target.addMatrixPackage(branchVal.node1, branchVal.node2, branchVal.R, branchVal.L, branchVal.C);
+                }
+            }
+            double assemblyTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / repeatCount;
+
+            // bulk(addBranches)
+            startTime = std::chrono::steady_clock::now();
+            for (long long int r = 0; r < repeatCount; r++)
+            {
+                Y_Matrix<> yMatrixBulk;
+                yMatrixBulk.addBranches(parsedBranch);
+            }
+            double bulkTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / repeatCount;
+
+            // lookup(getMatrix)
+            std::vector<std::pair<long long int, long long int>> query(SUITE_LOOKUP_COUNT);
+            std::vector<std::complex<long double>> lookupVal(SUITE_LOOKUP_COUNT);
+            for (long long int i = 0; i < SUITE_LOOKUP_COUNT; i++)
+            {
+                const Branch_Val& branchVal = parsedBranch[randomEngine() % parsedBranch.size()];
+                query[i] = { branchVal.node1, i % 2 == 0 ? branchVal.node1 : branchVal.node2 };
+            }
+            startTime = std::chrono::steady_clock::now();
+            yMatrix.getMatrix(query, lookupVal);
+            double lookupTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count() / SUITE_LOOKUP_COUNT;
+
+            // freeze
+            Y_Matrix_CSR matrixCSR;
+            startTime = std::chrono::steady_clock::now();
+            for (long long int r = 0; r < repeatCount; r++)
+            {
+                matrixCSR = yMatrix.freeze();
+            }
+            double freezeTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / repeatCount;
+
+            // output(MatrixMarket)
+            startTime = std::chrono::steady_clock::now();
+            for (long long int r = 0; r < repeatCount; r++)
+            {
+                FILE* matrixFile = std::tmpfile();
+                if (matrixFile == NULL)
+                {
+                    return false;
+                }
+                {
+                    Output_Writer matrixWriter(matrixFile);
+                    writeMatrixMarket(matrixCSR, busNum, matrixWriter);
+                }
+                fclose(matrixFile);
+            }
+            double outputTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / repeatCount;
+
+            // 결과 출력
+            writer.writeText(topologyName.c_str());
+            writer.writeChar(',');
+            writer.writeInt(branchCount);
+            writer.writeChar(',');
+            writer.writeInt(busNum.size());
+            writer.writeChar(',');
+            writer.writeInt(matrixCSR.colIdx.size());
+            writer.writeChar(',');
+            writer.writeInt(fileText.size());
+            writer.writeChar(',');
+            writer.writeInt(repeatCount);
+            writer.writeChar(',');
+            writer.writeFixed(parseTime, 6, 0);
+            writer.writeChar(',');
+            writer.writeFixed(assemblyTime, 6, 0);
+            writer.writeChar(',');
+            writer.writeFixed(bulkTime, 6, 0);
+            writer.writeChar(',');
+            writer.writeFixed(lookupTime, 3, 0);
+            writer.writeChar(',');
+            writer.writeFixed(freezeTime, 6, 0);
+            writer.writeChar(',');
+            writer.writeFixed(outputTime, 6, 0);
+            writer.writeChar('\n');
+            writer.flush();
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,23 @@
+﻿/* bench.hpp
+*
+* 임의의 계통 생성(--generate)과 성능 측정(--bench, --bench-suite, --bench-spmv)
+*/
+#ifndef Y_MATRIX_BENCH_HPP
+#define Y_MATRIX_BENCH_HPP
+
+#include<vector>
+#include<string>
+
+#include "io.hpp"
+
+void benchmarkMultiply(const Y_Matrix_CSR& matrixCSR, int threadCount);
+
+void benchmarkBuild();
+
+std::vector<Branch_Val> generateNetwork(const std::string& topology, long long int branchCount);
+
+void writeBranchFile(const std::vector<Branch_Val>& branch, Output_Writer& writer);
+
+bool benchmarkSuite(const std::vector<std::string>& topology, long long int maxBranchCount, Output_Writer& writer);
+
+#endif // Y_MATRIX_BENCH_HPP
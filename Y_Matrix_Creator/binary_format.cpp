@@ -0,0 +1,272 @@
+﻿#include<iostream>
+#include<cstdio>
+#include<cstring>
+
+#include "binary_format.hpp"
+
+/* checksumFNV() 함수
+*
+* 기능: 주어진 내용의 FNV-1a 64bit checksum을 구한다. 속도를 위해 1 Byte가 아닌 8 Byte(little-endian) 단위로 계산한다.
+*       앞부분의 checksum을 hash로 주면, 이어지는 내용까지의 checksum을 구한다.
+* 입력값: data, length(8의 배수), hash(앞부분의 checksum, 기본값은 FNV-1a의 시작값)
+* 출력값: checksum
+* 최종 수정일: 2026/10/17
+*/
+uint64_t checksumFNV(const unsigned char* data, unsigned long long int length, uint64_t hash)
+{
+
+    for (unsigned long long int i = 0; i + 8 <= length; i += 8)
+    {
+        hash ^= loadLE64(data + i);
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+/* isBinaryNetwork() 함수
+*
+* 기능: 주어진 파일이 Binary 파일 형식인지 확인한다.
+* 입력값: fileData, fileLength
+* 출력값: 파일의 앞부분이 magic과 같은 경우 참을, 그렇지 않은 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool isBinaryNetwork(const char* fileData, unsigned long long int fileLength)
+{
+    return fileLength >= sizeof(BINARY_MAGIC) && memcmp(fileData, BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0;
+}
+
+/* saveBinaryNetwork() 함수
+*
+* 기능: 선로, 소자 정보와 CSR 형태의 Y-Matrix를 Binary 파일로 저장한다.
+* 입력값: filePath, branch, device, matrixCSR, maxLength(node의 최댓값)
+* 출력값: 저장 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool saveBinaryNetwork(const std::string& filePath, const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, const Y_Matrix_CSR& matrixCSR, long long int maxLength)
+{
+    unsigned long long int nodeCount = matrixCSR.nodeNum.size(), entryCount = matrixCSR.colIdx.size();
+    unsigned long long int fileLength = BINARY_HEADER_SIZE + branch.size() * BINARY_BRANCH_SIZE + device.size() * BINARY_DEVICE_SIZE + (nodeCount * 2 + 1 + entryCount * 3) * 8;
+    std::vector<unsigned char> fileBuffer(fileLength, 0);
+    unsigned char* cursor = fileBuffer.data() + BINARY_HEADER_SIZE;
+
+    // 선로 정보 저장
+    for (unsigned long long int i = 0; i < branch.size(); i++, cursor += BINARY_BRANCH_SIZE)
+    {
+        storeLE64(cursor, branch[i].node1);
+        storeLE64(cursor + 8, branch[i].node2);
+        storeLE64(cursor + 16, std::bit_cast<uint64_t>((double)branch[i].R));
+        storeLE64(cursor + 24, std::bit_cast<uint64_t>((double)branch[i].L));
+        storeLE64(cursor + 32, std::bit_cast<uint64_t>((double)branch[i].C));
+    }
+
+    // 소자 정보 저장
+    for (unsigned long long int i = 0; i < device.size(); i++, cursor += BINARY_DEVICE_SIZE)
+    {
+        const long double value[7] = { device[i].R, device[i].L, device[i].C, device[i].tap, device[i].shift, device[i].G, device[i].B };
+        storeLE64(cursor, device[i].type);
+        storeLE64(cursor + 8, device[i].node1);
+        storeLE64(cursor + 16, device[i].node2);
+        for (int j = 0; j < 7; j++)
+        {
+            storeLE64(cursor + 24 + j * 8, std::bit_cast<uint64_t>((double)value[j]));
+        }
+    }
+
+    // Y-Matrix 저장
+    for (unsigned long long int i = 0; i < nodeCount; i++, cursor += 8)
+    {
+        storeLE64(cursor, matrixCSR.nodeNum[i]);
+    }
+    for (unsigned long long int i = 0; i <= nodeCount; i++, cursor += 8)
+    {
+        storeLE64(cursor, matrixCSR.rowPtr[i]);
+    }
+    for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+    {
+        storeLE64(cursor, matrixCSR.colIdx[i]);
+    }
+    for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+    {
+        storeLE64(cursor, std::bit_cast<uint64_t>((double)matrixCSR.G[i]));
+    }
+    for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+    {
+        storeLE64(cursor, std::bit_cast<uint64_t>((double)matrixCSR.jB[i]));
+    }
+
+    // Header 저장
+    uint32_t version = BINARY_VERSION, headerSize = BINARY_HEADER_SIZE;
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        version = ((version & 0xFF) << 24) | ((version & 0xFF00) << 8) | ((version >> 8) & 0xFF00) | (version >> 24);
+        headerSize = ((headerSize & 0xFF) << 24) | ((headerSize & 0xFF00) << 8) | ((headerSize >> 8) & 0xFF00) | (headerSize >> 24);
+    }
+    memcpy(fileBuffer.data(), BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    memcpy(fileBuffer.data() + 8, &version, 4);
+    memcpy(fileBuffer.data() + 12, &headerSize, 4);
+    storeLE64(fileBuffer.data() + 16, branch.size());
+    storeLE64(fileBuffer.data() + 24, nodeCount);
+    storeLE64(fileBuffer.data() + 32, entryCount);
+    storeLE64(fileBuffer.data() + 40, maxLength);
+    storeLE64(fileBuffer.data() + 48, checksumFNV(fileBuffer.data() + BINARY_HEADER_SIZE, fileLength - BINARY_HEADER_SIZE));
+    storeLE64(fileBuffer.data() + 56, device.size());
+
+    // 파일 쓰기
+    FILE* outputFile = fopen(filePath.c_str(), "wb");
+    if (outputFile == NULL)
+    {
+        return false;
+    }
+    bool isWritten = (fwrite(fileBuffer.data(), 1, fileLength, outputFile) == fileLength);
+    isWritten = (fclose(outputFile) == 0) && isWritten;
+
+    return isWritten;
+}
+
+/* loadBinaryNetwork() 함수
+*
+* 기능: memory에 mapping된 Binary 파일에서 선로, 소자 정보와 CSR 형태의 Y-Matrix를 읽는다.
+*       Header와 파일 길이, checksum을 확인하며, 각 값은 고정된 위치에서 바로 읽는다. (문자열 해석 없음)
+*       little-endian 환경에서는 nodeNum, rowPtr, colIdx 배열을 한 번에 복사하며, G, jB와 선로 값은 double에서 long double로 바꾸어 저장한다.
+*       findRow(), findEntry()가 이진 탐색을 하므로, nodeNum과 각 행의 colIdx가 오름차순(중복 없음)인지도 확인한다.
+* 입력값: fileData, fileLength, branch, device, matrixCSR, maxLength(읽은 값을 저장할 변수), errorMessage
+* 출력값: 읽기 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool loadBinaryNetwork(const char* fileData, unsigned long long int fileLength, std::vector<Branch_Val>& branch, std::vector<Device_Val>& device, Y_Matrix_CSR& matrixCSR,
+    long long int& maxLength, std::string& errorMessage)
+{
+    const unsigned char* data = (const unsigned char*)fileData;
+    uint32_t version, headerSize;
+
+    // Header 확인
+    if (fileLength < BINARY_HEADER_SIZE || !isBinaryNetwork(fileData, fileLength))
+    {
+        errorMessage = "Invalid Binary Header";
+        return false;
+    }
+    memcpy(&version, data + 8, 4);
+    memcpy(&headerSize, data + 12, 4);
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        version = ((version & 0xFF) << 24) | ((version & 0xFF00) << 8) | ((version >> 8) & 0xFF00) | (version >> 24);
+        headerSize = ((headerSize & 0xFF) << 24) | ((headerSize & 0xFF00) << 8) | ((headerSize >> 8) & 0xFF00) | (headerSize >> 24);
+    }
+    if (version != BINARY_VERSION || headerSize != BINARY_HEADER_SIZE)
+    {
+        errorMessage = "Unsupported Binary Version " + std::to_string(version);
+        return false;
+    }
+
+    unsigned long long int branchCount = loadLE64(data + 16), nodeCount = loadLE64(data + 24), entryCount = loadLE64(data + 32), deviceCount = loadLE64(data + 56);
+
+    // 파일 길이 확인(값이 잘못되어 계산이 넘치는 경우도 확인한다.)
+    unsigned long long int payloadLength = fileLength - BINARY_HEADER_SIZE;
+    if (branchCount > payloadLength / BINARY_BRANCH_SIZE || deviceCount > payloadLength / BINARY_DEVICE_SIZE || nodeCount > payloadLength / 16 || entryCount > payloadLength / 24
+        || branchCount * BINARY_BRANCH_SIZE + deviceCount * BINARY_DEVICE_SIZE + (nodeCount * 2 + 1 + entryCount * 3) * 8 != payloadLength)
+    {
+        errorMessage = "Binary File Length Mismatch";
+        return false;
+    }
+
+    // checksum 확인
+    if (checksumFNV(data + BINARY_HEADER_SIZE, payloadLength) != loadLE64(data + 48))
+    {
+        errorMessage = "Binary Checksum Mismatch";
+        return false;
+    }
+    maxLength = loadLE64(data + 40);
+
+    // 선로 정보 읽기
+    const unsigned char* cursor = data + BINARY_HEADER_SIZE;
+    branch.resize(branchCount);
+    for (unsigned long long int i = 0; i < branchCount; i++, cursor += BINARY_BRANCH_SIZE)
+    {
+        branch[i].node1 = loadLE64(cursor);
+        branch[i].node2 = loadLE64(cursor + 8);
+        branch[i].R = std::bit_cast<double>(loadLE64(cursor + 16));
+        branch[i].L = std::bit_cast<double>(loadLE64(cursor + 24));
+        branch[i].C = std::bit_cast<double>(loadLE64(cursor + 32));
+    }
+
+    // 소자 정보 읽기
+    device.resize(deviceCount);
+    for (unsigned long long int i = 0; i < deviceCount; i++, cursor += BINARY_DEVICE_SIZE)
+    {
+        long double* value[7] = { &device[i].R, &device[i].L, &device[i].C, &device[i].tap, &device[i].shift, &device[i].G, &device[i].B };
+        device[i].type = (int)loadLE64(cursor);
+        device[i].node1 = loadLE64(cursor + 8);
+        device[i].node2 = loadLE64(cursor + 16);
+        for (int j = 0; j < 7; j++)
+        {
+            *value[j] = std::bit_cast<double>(loadLE64(cursor + 24 + j * 8));
+        }
+        if (device[i].type != DEVICE_TRANSFORMER && device[i].type != DEVICE_SHUNT)
+        {
+            errorMessage = "Invalid Binary Device Type";
+            return false;
+        }
+    }
+
+    // Y-Matrix 읽기(정수 배열은 저장된 형식이 memory의 형식과 같은 경우 한 번에 복사한다.)
+    auto loadIndexArray = [&cursor](std::vector<long long int>& array, unsigned long long int count)
+    {
+        array.resize(count);
+        if constexpr (std::endian::native == std::endian::little && sizeof(long long int) == 8)
+        {
+            if (count > 0)
+            {
+                memcpy(array.data(), cursor, count * 8);
+            }
+        }else{
+            for (unsigned long long int i = 0; i < count; i++)
+            {
+                array[i] = loadLE64(cursor + i * 8);
+            }
+        }
+        cursor += count * 8;
+    };
+    loadIndexArray(matrixCSR.nodeNum, nodeCount);
+    loadIndexArray(matrixCSR.rowPtr, nodeCount + 1);
+    loadIndexArray(matrixCSR.colIdx, entryCount);
+    matrixCSR.G.resize(entryCount);
+    matrixCSR.jB.resize(entryCount);
+    for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+    {
+        matrixCSR.G[i] = std::bit_cast<double>(loadLE64(cursor));
+    }
+    for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+    {
+        matrixCSR.jB[i] = std::bit_cast<double>(loadLE64(cursor));
+    }
+
+    // CSR 구조 확인(잘못된 위치를 읽지 않도록 한다.)
+    if (matrixCSR.rowPtr[0] != 0 || matrixCSR.rowPtr[nodeCount] != (long long int)entryCount)
+    {
+        errorMessage = "Invalid Binary Matrix Structure";
+        return false;
+    }
+    for (unsigned long long int i = 0; i < nodeCount; i++)
+    {
+        if (matrixCSR.rowPtr[i] > matrixCSR.rowPtr[i + 1] || (i > 0 && matrixCSR.nodeNum[i - 1] >= matrixCSR.nodeNum[i]))
+        {
+            errorMessage = "Invalid Binary Matrix Structure";
+            return false;
+        }
+    }
+    for (unsigned long long int row = 0; row < nodeCount; row++)
+    {
+        for (long long int i = matrixCSR.rowPtr[row]; i < matrixCSR.rowPtr[row + 1]; i++)
+        {
+            // 열 위치는 범위 안에 있고, 행 안에서 오름차순이어야 한다.
+            if (matrixCSR.colIdx[i] < 0 || matrixCSR.colIdx[i] >= (long long int)nodeCount || (i > matrixCSR.rowPtr[row] && matrixCSR.colIdx[i - 1] >= matrixCSR.colIdx[i]))
+            {
+                errorMessage = "Invalid Binary Matrix Structure";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
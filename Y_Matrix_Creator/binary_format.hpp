@@ -0,0 +1,80 @@
+﻿/* binary_format.hpp
+*
+* 선로 정보와 구성된 Y-Matrix의 Binary 파일 저장과 읽기(--save-bin 옵션)
+*/
+#ifndef Y_MATRIX_BINARY_FORMAT_HPP
+#define Y_MATRIX_BINARY_FORMAT_HPP
+
+#include<string>
+#include<vector>
+#include<cstdint>
+#include<bit>
+
+#include "y_matrix.hpp"
+
+/* Binary 파일 형식
+*
+* 모든 값은 little-endian이며, 실수는 IEEE 754 64bit(double)로 저장한다.
+* Header(64 Byte): magic("YMATBIN\0", 8 Byte), version(4 Byte), header 길이(4 Byte), 선로 수, 행의 수, 0이 아닌 값의 수,
+*                  node의 최댓값, checksum(Header 뒤의 모든 내용을 8 Byte 단위로 읽은 FNV-1a 64bit 값), 소자 수 (각 8 Byte)
+* 선로(40 Byte씩): node1, node2, R, L, C
+* 소자(80 Byte씩): type, node1, node2, R, L, C, tap, shift, G, B (입력 파일의 순서)
+* Y-Matrix(CSR 형태): nodeNum(행의 수), rowPtr(행의 수 + 1), colIdx, G, jB(0이 아닌 값의 수) (각 8 Byte씩)
+* version 1은 소자를 저장하지 않아(소자 수 자리는 예약), 변경 기록이나 Server에서 변압기, 병렬 소자가 빠지므로 읽지 않는다.
+*/
+const char BINARY_MAGIC[8] = { 'Y', 'M', 'A', 'T', 'B', 'I', 'N', '\0' };
+const uint32_t BINARY_VERSION = 2;
+const unsigned long long int BINARY_HEADER_SIZE = 64;
+const unsigned long long int BINARY_BRANCH_SIZE = 40;
+const unsigned long long int BINARY_DEVICE_SIZE = 80;
+
+/* storeLE64() 함수
+*
+* 기능: 64bit 값을 little-endian으로 주어진 위치에 저장한다.
+* 입력값: location, value
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+inline void storeLE64(unsigned char* location, uint64_t value)
+{
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        value = ((value & 0x00000000000000FFULL) << 56) | ((value & 0x000000000000FF00ULL) << 40) | ((value & 0x0000000000FF0000ULL) << 24) | ((value & 0x00000000FF000000ULL) << 8)
+            | ((value & 0x000000FF00000000ULL) >> 8) | ((value & 0x0000FF0000000000ULL) >> 24) | ((value & 0x00FF000000000000ULL) >> 40) | ((value & 0xFF00000000000000ULL) >> 56);
+    }
+    memcpy(location, &value, 8);
+
+    return;
+}
+
+/* loadLE64() 함수
+*
+* 기능: 주어진 위치에 little-endian으로 저장된 64bit 값을 읽는다.
+* 입력값: location
+* 출력값: 읽은 값
+* 최종 수정일: 2026/10/17
+*/
+inline uint64_t loadLE64(const unsigned char* location)
+{
+    uint64_t value;
+
+    memcpy(&value, location, 8);
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        value = ((value & 0x00000000000000FFULL) << 56) | ((value & 0x000000000000FF00ULL) << 40) | ((value & 0x0000000000FF0000ULL) << 24) | ((value & 0x00000000FF000000ULL) << 8)
+            | ((value & 0x000000FF00000000ULL) >> 8) | ((value & 0x0000FF0000000000ULL) >> 24) | ((value & 0x00FF000000000000ULL) >> 40) | ((value & 0xFF00000000000000ULL) >> 56);
+    }
+
+    return value;
+}
+
+uint64_t checksumFNV(const unsigned char* data, unsigned long long int length, uint64_t hash = 0xCBF29CE484222325ULL);
+
+bool isBinaryNetwork(const char* fileData, unsigned long long int fileLength);
+
+bool saveBinaryNetwork(const std::string& filePath, const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, const Y_Matrix_CSR& matrixCSR, long long int maxLength);
+
+bool loadBinaryNetwork(const char* fileData, unsigned long long int fileLength, std::vector<Branch_Val>& branch, std::vector<Device_Val>& device, Y_Matrix_CSR& matrixCSR,
+    long long int& maxLength, std::string& errorMessage);
+
+#endif // Y_MATRIX_BINARY_FORMAT_HPP
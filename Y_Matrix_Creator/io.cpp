@@ -0,0 +1,1330 @@
+﻿#include<iostream>
+#include<cstring>
+#include<queue>
+
+#ifndef _WIN32
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<fcntl.h>
+#include<unistd.h>
+#endif
+
+#include "io.hpp"
+
+/* Mapped_File의 생성자
+*
+* 특별한 기능 없음
+* 최종 수정일: 2026/10/17
+*/
+Mapped_File::Mapped_File()
+{
+    fileData = NULL;
+    fileLength = 0;
+#ifdef _WIN32
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = NULL;
+#else
+    fileDescriptor = -1;
+#endif
+
+    return;
+}
+
+/* Mapped_File의 소멸자
+*
+* 기능: 열린 파일을 닫는다.
+* 최종 수정일: 2026/10/17
+*/
+Mapped_File::~Mapped_File()
+{
+    close();
+
+    return;
+}
+
+/* Mapped_File::open() 함수
+*
+* 기능: 주어진 파일을 읽기 전용으로 memory에 mapping한다. 빈 파일은 길이가 0인 파일로 연다.
+* 입력값: filePath
+* 출력값: 파일 열기 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool Mapped_File::open(const std::string& filePath)
+{
+    close();
+
+#ifdef _WIN32
+    LARGE_INTEGER length;
+
+    fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &length))
+    {
+        close();
+        return false;
+    }
+    fileLength = length.QuadPart;
+
+    // 빈 파일은 mapping할 수 없으므로, 길이가 0인 파일로 처리한다.
+    if (fileLength == 0)
+    {
+        return true;
+    }
+
+    mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mappingHandle == NULL)
+    {
+        close();
+        return false;
+    }
+    fileData = (const char*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+#else
+    struct stat fileStat;
+
+    fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor == -1 || fstat(fileDescriptor, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+    {
+        close();
+        return false;
+    }
+    fileLength = fileStat.st_size;
+
+    // 빈 파일은 mapping할 수 없으므로, 길이가 0인 파일로 처리한다.
+    if (fileLength == 0)
+    {
+        return true;
+    }
+
+    void* mappedData = mmap(NULL, fileLength, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mappedData == MAP_FAILED)
+    {
+        close();
+        return false;
+    }
+    // 처음부터 순서대로 읽음을 알린다.
+    madvise(mappedData, fileLength, MADV_SEQUENTIAL);
+    fileData = (const char*)mappedData;
+#endif
+
+    if (fileData == NULL)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+/* Mapped_File::close() 함수
+*
+* 기능: mapping을 해제하고, 파일을 닫는다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Mapped_File::close()
+{
+#ifdef _WIN32
+    if (fileData != NULL)
+    {
+        UnmapViewOfFile(fileData);
+    }
+    if (mappingHandle != NULL)
+    {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(fileHandle);
+    }
+    fileHandle = INVALID_HANDLE_VALUE;
+    mappingHandle = NULL;
+#else
+    if (fileData != NULL)
+    {
+        munmap((void*)fileData, fileLength);
+    }
+    if (fileDescriptor != -1)
+    {
+        ::close(fileDescriptor);
+    }
+    fileDescriptor = -1;
+#endif
+    fileData = NULL;
+    fileLength = 0;
+
+    return;
+}
+
+/* Mapped_File::data() 함수
+*
+* 기능: 파일의 내용이 위치한 주소를 반환한다.
+* 입력값 없음
+* 출력값: 파일의 내용이 위치한 주소(빈 파일인 경우 NULL)
+* 최종 수정일: 2026/10/17
+*/
+const char* Mapped_File::data() const
+{
+    return fileData;
+}
+
+/* Mapped_File::size() 함수
+*
+* 기능: 파일의 길이를 반환한다.
+* 입력값 없음
+* 출력값: 파일의 길이(Byte)
+* 최종 수정일: 2026/10/17
+*/
+unsigned long long int Mapped_File::size() const
+{
+    return fileLength;
+}
+
+/* parseRealValue() 함수
+*
+* 기능: 문자열에서 실수 하나를 읽는다.
+*       유효숫자가 19자리 이하이고 10의 지수가 27 이하인 경우(long double이 double과 같은 경우 15자리, 22 이하), 정수로 읽은 유효숫자와
+*       10의 거듭제곱이 long double에서 정확히 표현되므로 한 번의 곱셈 또는 나눗셈으로 정확히 반올림된 값을 구한다. 그 외의 경우, std::from_chars로 읽는다.
+*       유효숫자가 0인 경우, 지수와 관계없이 부호를 가진 0을 바로 반환한다.
+* 입력값: first, last(읽을 문자열의 범위), value(읽은 값을 저장할 변수)
+* 출력값: std::from_chars와 같은 형식의 결과(읽은 문자열의 끝 위치, 오류 여부)
+* 최종 수정일: 2026/10/17
+*/
+std::from_chars_result parseRealValue(const char* first, const char* last, long double& value)
+{
+    // 10^0 ~ 10^27 (long double에서 정확히 표현되는 10의 거듭제곱)
+    static const long double powerOfTen[28] = { 1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+        1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L };
+
+    // long double의 유효숫자(bit 수)에 따라, 정수로 정확히 표현되는 유효숫자의 자릿수와 정확히 표현되는 10의 거듭제곱의 범위를 정한다.
+    // (x87 확장 정밀도 이상은 64bit, Windows와 같이 long double이 double과 같은 경우 53bit)
+    constexpr bool isExtended = std::numeric_limits<long double>::digits >= 64;
+    constexpr int maxDigitCount = isExtended ? 19 : 15;
+    constexpr int maxExponent = isExtended ? 27 : 22;
+    static_assert(std::numeric_limits<long double>::digits >= 53, "long double must have at least double precision");
+
+    const char* cursor = first;
+    unsigned long long int mantissa = 0; // 유효숫자
+    int digitCount = 0, exponent = 0, exponentValue = 0; // 유효숫자의 자릿수, 10의 지수, e 뒤에 주어진 지수
+    bool isNegative = false, hasDigit = false, isExponentNegative = false;
+
+    if (cursor < last && *cursor == '-')
+    {
+        isNegative = true;
+        cursor++;
+    }
+
+    // 정수부와 소수부를 읽는다. (앞자리의 0은 유효숫자로 세지 않는다.)
+    for (bool isFraction = false; cursor < last; cursor++)
+    {
+        if (*cursor >= '0' && *cursor <= '9')
+        {
+            hasDigit = true;
+            if (mantissa != 0 || *cursor != '0')
+            {
+                // 유효숫자가 정확히 표현되는 자릿수를 넘는 경우, std::from_chars로 읽는다.
+                if (++digitCount > maxDigitCount)
+                {
+                    return std::from_chars(first, last, value);
+                }
+                mantissa = mantissa * 10 + (*cursor - '0');
+            }
+            if (isFraction)
+            {
+                exponent--;
+            }
+        }else if (*cursor == '.' && !isFraction)
+        {
+            isFraction = true;
+        }else{
+            break;
+        }
+    }
+
+    // 숫자가 없는 경우(inf, nan 등), std::from_chars로 읽는다.
+    if (!hasDigit)
+    {
+        return std::from_chars(first, last, value);
+    }
+
+    // 지수부를 읽는다.
+    if (cursor < last && (*cursor == 'e' || *cursor == 'E'))
+    {
+        const char* exponentCursor = cursor + 1;
+
+        if (exponentCursor < last && (*exponentCursor == '-' || *exponentCursor == '+'))
+        {
+            isExponentNegative = (*exponentCursor == '-');
+            exponentCursor++;
+        }
+
+        // e 뒤에 숫자가 있는 경우에만 지수부로 읽는다.
+        if (exponentCursor < last && *exponentCursor >= '0' && *exponentCursor <= '9')
+        {
+            for (; exponentCursor < last && *exponentCursor >= '0' && *exponentCursor <= '9'; exponentCursor++)
+            {
+                if (exponentValue > 10000)
+                {
+                    return std::from_chars(first, last, value);
+                }
+                exponentValue = exponentValue * 10 + (*exponentCursor - '0');
+            }
+            exponent += isExponentNegative ? -exponentValue : exponentValue;
+            cursor = exponentCursor;
+        }
+    }
+
+    // 유효숫자가 0인 경우, 지수와 관계없이 0이다. (표의 범위를 벗어난 지수로 읽지 않는다.)
+    if (mantissa == 0)
+    {
+        value = isNegative ? -0.0L : 0.0L;
+        return std::from_chars_result{ cursor, std::errc() };
+    }
+
+    // 10의 거듭제곱이 정확히 표현되지 않는 경우, std::from_chars로 읽는다.
+    if (exponent > maxExponent || exponent < -maxExponent)
+    {
+        return std::from_chars(first, last, value);
+    }
+
+    if (exponent >= 0)
+    {
+        value = (long double)mantissa * powerOfTen[exponent];
+    }else{
+        value = (long double)mantissa / powerOfTen[-exponent];
+    }
+    if (isNegative)
+    {
+        value = -value;
+    }
+
+    return std::from_chars_result{ cursor, std::errc() };
+}
+
+/* parseBranchFile() 함수
+*
+* 기능: 입력 파일의 내용을 한 줄씩 읽어, (Node1) (Node2) (R) (L) (C) 형식의 선로 정보를 branch vector에 추가한다.
+*       device가 주어진 경우, T (Node1) (Node2) (R) (L) (C) (tap) (shift) 형식의 변압기와 S (Node) (G) (B) 형식의 병렬 소자도 읽어 device vector에 추가한다.
+*       빈 줄은 무시하며, 형식에 맞지 않는 줄을 만난 경우 해당 줄의 번호와 내용을 errorMessage에 저장한다.
+* 입력값: fileData, fileLength(읽을 내용과 길이), branch(선로 정보를 저장할 vector), errorMessage, device(소자 정보를 저장할 vector, NULL인 경우 소자를 읽지 않는다.)
+* 출력값: 모든 줄을 읽은 경우 참을, 형식에 맞지 않는 줄이 있는 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool parseBranchFile(const char* fileData, unsigned long long int fileLength, std::vector<Branch_Val>& branch, std::string& errorMessage, std::vector<Device_Val>* device)
+{
+    const char* cursor = fileData; // 읽고 있는 위치
+    const char* fileEnd = fileData + fileLength; // 파일의 끝
+    const char* lineStart; // 읽고 있는 줄의 시작 위치
+    long long int lineNumber = 0; // 읽고 있는 줄의 번호
+    Branch_Val branchVal;
+    Device_Val deviceVal;
+    std::from_chars_result result;
+
+    // 파일 끝까지 반복
+    while (cursor < fileEnd)
+    {
+        lineStart = cursor;
+        lineNumber++;
+
+        // 줄에서 읽을 값의 위치와 값을 저장할 변수(기본은 선로이며, 첫 값이 T 또는 S인 경우 소자로 바꾼다.)
+        long long int* nodeField[2] = { &branchVal.node1, &branchVal.node2 };
+        long double* realField[5] = { &branchVal.R, &branchVal.L, &branchVal.C, NULL, NULL };
+        int nodeCount = 2, valueCount = 5; // 읽을 node 번호의 수, 전체 값의 수
+        int deviceType = 0; // 소자의 종류(선로인 경우 0)
+        int fieldCount = 0;
+        const char* fieldError = NULL;
+
+        while (cursor < fileEnd && *cursor != '\n')
+        {
+            // 빈칸 넘기기
+            if (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')
+            {
+                cursor++;
+                continue;
+            }
+
+            // 줄의 첫 값이 T(변압기) 또는 S(병렬 소자)인 경우
+            if (fieldCount == 0 && deviceType == 0 && (*cursor == 'T' || *cursor == 'S'))
+            {
+                if (device == NULL)
+                {
+                    fieldError = "Device Record Not Allowed";
+                    break;
+                }
+
+                deviceVal = {};
+                if (*cursor == 'T')
+                {
+                    deviceType = DEVICE_TRANSFORMER;
+                    nodeField[0] = &deviceVal.node1;
+                    nodeField[1] = &deviceVal.node2;
+                    realField[0] = &deviceVal.R;
+                    realField[1] = &deviceVal.L;
+                    realField[2] = &deviceVal.C;
+                    realField[3] = &deviceVal.tap;
+                    realField[4] = &deviceVal.shift;
+                    valueCount = 7;
+                }else{
+                    deviceType = DEVICE_SHUNT;
+                    nodeField[0] = &deviceVal.node1;
+                    realField[0] = &deviceVal.G;
+                    realField[1] = &deviceVal.B;
+                    nodeCount = 1;
+                    valueCount = 3;
+                }
+                deviceVal.type = deviceType;
+
+                // 종류를 나타내는 문자 뒤에는 빈칸이 있어야 한다.
+                cursor++;
+                if (cursor < fileEnd && *cursor != ' ' && *cursor != '\t')
+                {
+                    fieldError = "Invalid Value";
+                    break;
+                }
+                continue;
+            }
+
+            // 값의 수가 넘치는 경우
+            if (fieldCount == valueCount)
+            {
+                fieldError = "Too Many Values";
+                break;
+            }
+
+            // from_chars는 '+' 부호를 읽지 않으므로, 직접 넘긴다.
+            cursor = skipPlusSign(cursor, fileEnd);
+
+            // node 번호는 정수로, 나머지 값은 실수로 읽는다.
+            if (fieldCount < nodeCount)
+            {
+                result = std::from_chars(cursor, fileEnd, *nodeField[fieldCount]);
+            }else{
+                result = parseRealValue(cursor, fileEnd, *realField[fieldCount - nodeCount]);
+            }
+
+            // 값을 읽지 못했거나, 값 뒤에 빈칸이 아닌 문자가 이어진 경우
+            if (result.ec != std::errc() || (result.ptr < fileEnd && *result.ptr != ' ' && *result.ptr != '\t' && *result.ptr != '\r' && *result.ptr != '\n'))
+            {
+                fieldError = "Invalid Value";
+                break;
+            }
+
+            cursor = result.ptr;
+            fieldCount++;
+        }
+
+        // 값이 모자란 경우(빈 줄은 무시한다.)
+        if (fieldError == NULL && (fieldCount != 0 || deviceType != 0) && fieldCount != valueCount)
+        {
+            fieldError = "Too Few Values";
+        }
+
+        // 변압기는 서로 다른 두 node를 잇고, tap 비가 0보다 커야 한다.
+        if (fieldError == NULL && deviceType == DEVICE_TRANSFORMER)
+        {
+            if (deviceVal.node1 == deviceVal.node2)
+            {
+                fieldError = "Same Node";
+            }else if (!(deviceVal.tap > 0))
+            {
+                fieldError = "Invalid Tap Ratio";
+            }
+        }
+
+        // 형식에 맞지 않는 경우, 줄 번호와 해당 줄의 내용을 기록한다.
+        if (fieldError != NULL)
+        {
+            const char* lineEnd = (const char*)memchr(lineStart, '\n', fileEnd - lineStart);
+            if (lineEnd == NULL)
+            {
+                lineEnd = fileEnd;
+            }
+            if (lineEnd > lineStart && lineEnd[-1] == '\r')
+            {
+                lineEnd--;
+            }
+            errorMessage = "Line " + std::to_string(lineNumber) + ": " + fieldError + " (" + std::string(lineStart, lineEnd) + ")";
+            return false;
+        }
+
+        if (deviceType != 0)
+        {
+            if (deviceType == DEVICE_SHUNT)
+            {
+                deviceVal.node2 = deviceVal.node1;
+            }
+            device->push_back(deviceVal);
+        }else if (fieldCount == 5)
+        {
+            branch.push_back(branchVal);
+        }
+
+        // 줄바꿈 문자 넘기기
+        cursor++;
+    }
+    STATS_ADD(STAT_PARSE_BYTE, fileLength);
+    STATS_ADD(STAT_PARSE_LINE, lineNumber);
+
+    return true;
+}
+
+/* Output_Writer의 생성자
+*
+* 기능: 출력할 파일을 지정하고, buffer를 준비한다.
+* 최종 수정일: 2026/10/17
+*/
+Output_Writer::Output_Writer(FILE* file)
+{
+    outputFile = file;
+    buffer.resize(1 << 20);
+    used = 0;
+    isWriteFailed = false;
+
+    return;
+}
+
+/* Output_Writer의 소멸자
+*
+* 기능: buffer에 남아있는 문자열을 출력한다.
+* 최종 수정일: 2026/10/17
+*/
+Output_Writer::~Output_Writer()
+{
+    flush();
+
+    return;
+}
+
+/* Output_Writer::reserveBuffer() 함수
+*
+* 기능: buffer에 주어진 길이만큼의 여유 공간이 없는 경우, buffer의 내용을 출력하여 공간을 확보한다.
+* 입력값: length
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::reserveBuffer(unsigned long long int length)
+{
+    if (used + length > buffer.size())
+    {
+        flush();
+    }
+
+    return;
+}
+
+/* Output_Writer::writeText() 함수
+*
+* 기능: 문자열을 출력한다.
+* 입력값: text
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::writeText(const char* text)
+{
+    unsigned long long int length = strlen(text);
+
+    // buffer보다 긴 문자열은 바로 출력한다.
+    if (length > buffer.size())
+    {
+        flush();
+        if (fwrite(text, 1, length, outputFile) != length)
+        {
+            isWriteFailed = true;
+        }
+        return;
+    }
+
+    reserveBuffer(length);
+    memcpy(buffer.data() + used, text, length);
+    used += length;
+
+    return;
+}
+
+/* Output_Writer::writeChar() 함수
+*
+* 기능: 문자 하나를 출력한다.
+* 입력값: character
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::writeChar(char character)
+{
+    reserveBuffer(1);
+    buffer[used++] = character;
+
+    return;
+}
+
+/* Output_Writer::writeInt() 함수
+*
+* 기능: 정수를 출력한다.
+* 입력값: value
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::writeInt(long long int value)
+{
+    reserveBuffer(32);
+    used = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), value).ptr - buffer.data();
+
+    return;
+}
+
+/* Output_Writer::writeReal() 함수
+*
+* 기능: 실수를 다시 읽었을 때 같은 값이 되는 가장 짧은 형태로 출력한다.
+* 입력값: value
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::writeReal(long double value)
+{
+    reserveBuffer(64);
+    used = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), value).ptr - buffer.data();
+
+    return;
+}
+
+/* Output_Writer::writeReal() 함수
+*
+* 기능: double 형식의 실수를 다시 읽었을 때 같은 값이 되는 가장 짧은 형태로 출력한다.
+* 입력값: value
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::writeReal(double value)
+{
+    reserveBuffer(64);
+    used = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), value).ptr - buffer.data();
+
+    return;
+}
+
+/* Output_Writer::writeFixed() 함수
+*
+* 기능: 실수를 소숫점 아래 precision자리까지, 최소 width칸을 차지하도록 오른쪽 정렬하여 출력한다.
+* 입력값: value, precision, width
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::writeFixed(long double value, int precision, int width)
+{
+    char number[5000];
+    long long int length = std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, precision).ptr - number;
+
+    reserveBuffer(length + width);
+    for (long long int i = length; i < width; i++)
+    {
+        buffer[used++] = ' ';
+    }
+    memcpy(buffer.data() + used, number, length);
+    used += length;
+
+    return;
+}
+
+/* Output_Writer::flush() 함수
+*
+* 기능: buffer에 모인 문자열을 파일로 출력한다. 다 쓰지 못한 경우 이를 기록한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Output_Writer::flush()
+{
+    if (used > 0)
+    {
+        if (fwrite(buffer.data(), 1, used, outputFile) != used)
+        {
+            isWriteFailed = true;
+        }
+        STATS_ADD(STAT_OUTPUT_BYTE, used);
+        used = 0;
+    }
+    if (fflush(outputFile) != 0)
+    {
+        isWriteFailed = true;
+    }
+
+    return;
+}
+
+/* Output_Writer::failed() 함수
+*
+* 기능: 지금까지 출력한 내용을 파일에 다 쓰지 못한 적이 있는지 확인한다. (buffer에 남은 내용은 flush() 뒤에 확인한다.)
+* 입력값 없음
+* 출력값: 다 쓰지 못한 적이 있는 경우 참
+* 최종 수정일: 2026/10/17
+*/
+bool Output_Writer::failed() const
+{
+    return isWriteFailed;
+}
+
+/* isContiguousNode() 함수
+*
+* 기능: 출력할 node 번호가 1번부터 N번까지 차례대로 이어지는지 확인한다. 이 경우, 출력에서 node 번호를 따로 표시하지 않는다.
+* 입력값: busNum(출력할 순서대로 나열한 node 번호)
+* 출력값: 이어지는지 여부
+* 최종 수정일: 2026/10/17
+*/
+bool isContiguousNode(const std::vector<long long int>& busNum)
+{
+    for (unsigned long long int i = 0; i < busNum.size(); i++)
+    {
+        if (busNum[i] != (long long int)i + 1)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* findOutputRow() 함수
+*
+* 기능: 출력할 순서의 각 node가 CSR의 몇 번째 행인지, CSR의 각 행이 몇 번째로 출력되는지 찾는다.
+* 입력값: matrixCSR, busNum(출력할 순서대로 나열한 node 번호), outputRow(각 순서의 CSR 행의 위치, 행이 없는 경우 -1),
+*         outputOrder(CSR의 각 행의 출력 순서)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void findOutputRow(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, std::vector<long long int>& outputRow, std::vector<long long int>& outputOrder)
+{
+    outputRow.resize(busNum.size());
+    outputOrder.assign(matrixCSR.nodeNum.size(), -1);
+    for (unsigned long long int i = 0; i < busNum.size(); i++)
+    {
+        outputRow[i] = matrixCSR.findRow(busNum[i]);
+        if (outputRow[i] != -1)
+        {
+            outputOrder[outputRow[i]] = i;
+        }
+    }
+
+    return;
+}
+
+/* writeDenseMatrix() 함수
+*
+* 기능: CSR 형태의 Y-Matrix를 입력에 나온 모든 node에 대한 전체 행렬 형태로 출력한다. (0인 값도 출력)
+*       행과 열은 busNum의 순서로 출력하며, node 번호가 1번부터 차례대로 이어지지 않는 경우, 행렬 앞에 행과 열의 순서대로 node 번호를 출력한다.
+* 입력값: matrixCSR, busNum(출력할 순서대로 나열한 node 번호), writer
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void writeDenseMatrix(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, Output_Writer& writer)
+{
+    long long int busCount = busNum.size(); // 행렬의 크기
+    std::vector<long long int> outputRow, outputOrder; // 각 순서의 CSR 행의 위치, CSR의 각 행의 출력 순서
+    std::vector<long long int> entry(busCount, -1); // 출력하고 있는 행에서 각 열의 값이 저장된 위치(없는 경우 -1)
+    long double ans[2]; // 해당 위치의 어드미턴스값
+
+    findOutputRow(matrixCSR, busNum, outputRow, outputOrder);
+
+    // 행렬의 크기를 출력한다.
+    writer.writeInt(busCount);
+    writer.writeChar('*');
+    writer.writeInt(busCount);
+    writer.writeText(" Matrix\n");
+
+    // node 번호가 1번부터 이어지지 않는 경우, 행과 열의 node 번호를 출력한다.
+    if (!isContiguousNode(busNum))
+    {
+        writer.writeText("Node:");
+        for (long long int i = 0; i < busCount; i++)
+        {
+            writer.writeChar(' ');
+            writer.writeInt(busNum[i]);
+        }
+        writer.writeChar('\n');
+    }
+
+    // 행렬을 모두 출력한다.
+    for (long long int i = 0; i < busCount; i++)
+    {
+        // 해당 행에 저장된 값의 위치를 출력할 열의 순서로 옮긴다.
+        long long int row = outputRow[i];
+        if (row != -1)
+        {
+            for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+            {
+                entry[outputOrder[matrixCSR.colIdx[cursor]]] = cursor;
+            }
+        }
+
+        for (long long int j = 0; j < busCount; j++)
+        {
+            // 해당 열의 값이 저장되어 있는 경우 그 값을, 그렇지 않은 경우 0을 출력한다.
+            if (entry[j] != -1)
+            {
+                ans[0] = matrixCSR.G[entry[j]];
+                ans[1] = matrixCSR.jB[entry[j]];
+                entry[j] = -1;
+            }else{
+                ans[0] = 0;
+                ans[1] = 0;
+            }
+            writer.writeFixed(ans[0], 6, 14);
+            writer.writeChar(ans[1] >= 0 ? '+' : '-');
+            writer.writeFixed(ans[1] >= 0 ? ans[1] : -ans[1], 6, 0);
+            writer.writeText("  ");
+        }
+        writer.writeChar('\n');
+    }
+
+    return;
+}
+
+/* writeMatrixMarket() 함수
+*
+* 기능: CSR 형태의 Y-Matrix에서 0이 아닌 값만을 MatrixMarket Coordinate 형식(complex general)으로 출력한다.
+*       행렬의 크기는 입력에 나온 node의 수이며, 행과 열은 busNum에서의 순서(1부터)로 나타낸다.
+*       node 번호가 1번부터 차례대로 이어지지 않는 경우, Header 뒤에 "% (순서) (node 번호)" 형식의 주석으로 각 node 번호를 출력한다.
+* 입력값: matrixCSR, busNum(출력할 순서대로 나열한 node 번호), writer
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void writeMatrixMarket(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, Output_Writer& writer)
+{
+    std::vector<long long int> outputRow, outputOrder; // 각 순서의 CSR 행의 위치, CSR의 각 행의 출력 순서
+
+    findOutputRow(matrixCSR, busNum, outputRow, outputOrder);
+
+    // Header와 node 번호, 행렬의 크기, 0이 아닌 값의 수를 출력한다.
+    writer.writeText("%%MatrixMarket matrix coordinate complex general\n");
+    if (!isContiguousNode(busNum))
+    {
+        for (unsigned long long int i = 0; i < busNum.size(); i++)
+        {
+            writer.writeText("% ");
+            writer.writeInt(i + 1);
+            writer.writeChar(' ');
+            writer.writeInt(busNum[i]);
+            writer.writeChar('\n');
+        }
+    }
+    writer.writeInt(busNum.size());
+    writer.writeChar(' ');
+    writer.writeInt(busNum.size());
+    writer.writeChar(' ');
+    writer.writeInt(matrixCSR.colIdx.size());
+    writer.writeChar('\n');
+
+    // 출력할 순서대로 (node1, node2, G, jB)를 출력한다.
+    for (unsigned long long int i = 0; i < busNum.size(); i++)
+    {
+        long long int row = outputRow[i];
+        if (row == -1)
+        {
+            continue;
+        }
+
+        for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+        {
+            writer.writeInt(i + 1);
+            writer.writeChar(' ');
+            writer.writeInt(outputOrder[matrixCSR.colIdx[cursor]] + 1);
+            writer.writeChar(' ');
+            writer.writeReal(matrixCSR.G[cursor]);
+            writer.writeChar(' ');
+            writer.writeReal(matrixCSR.jB[cursor]);
+            writer.writeChar('\n');
+        }
+    }
+
+    return;
+}
+
+/* writeTripletCSV() 함수
+*
+* 기능: CSR 형태의 Y-Matrix에서 0이 아닌 값만을 node1,node2,G,jB 형태의 CSV 형식으로 출력한다. 행은 busNum의 순서로 출력한다.
+* 입력값: matrixCSR, busNum(출력할 순서대로 나열한 node 번호), writer
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void writeTripletCSV(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, Output_Writer& writer)
+{
+    std::vector<long long int> outputRow, outputOrder; // 각 순서의 CSR 행의 위치, CSR의 각 행의 출력 순서
+
+    findOutputRow(matrixCSR, busNum, outputRow, outputOrder);
+
+    writer.writeText("node1,node2,G,jB\n");
+
+    // 출력할 순서대로 (node1, node2, G, jB)를 출력한다.
+    for (unsigned long long int i = 0; i < busNum.size(); i++)
+    {
+        long long int row = outputRow[i];
+        if (row == -1)
+        {
+            continue;
+        }
+
+        for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+        {
+            writer.writeInt(matrixCSR.nodeNum[row]);
+            writer.writeChar(',');
+            writer.writeInt(matrixCSR.nodeNum[matrixCSR.colIdx[cursor]]);
+            writer.writeChar(',');
+            writer.writeReal(matrixCSR.G[cursor]);
+            writer.writeChar(',');
+            writer.writeReal(matrixCSR.jB[cursor]);
+            writer.writeChar('\n');
+        }
+    }
+
+    return;
+}
+
+/* reorderRCM() 함수
+*
+* 기능: Y-Matrix의 graph(0이 아닌 값이 있는 (node1, node2)를 연결된 것으로 본다.)에서 Reverse Cuthill-McKee 순서를 구한다.
+*       연결된 부분마다 가장자리에 가까운 node(pseudo-peripheral node)에서 시작하여, 차수가 작은 node부터 너비 우선 탐색으로 번호를 매긴 뒤,
+*       전체 순서를 뒤집는다. 이 순서로 행과 열을 바꾸면, 0이 아닌 값이 대각선 근처에 모인다.
+* 입력값: matrixCSR
+* 출력값: 새로운 순서대로 나열한 CSR의 행의 위치
+* 최종 수정일: 2026/10/17
+*/
+std::vector<long long int> reorderRCM(const Y_Matrix_CSR& matrixCSR)
+{
+    long long int rowCount = matrixCSR.nodeNum.size();
+    std::vector<long long int> order, degree(rowCount), level(rowCount, -1);
+    std::vector<char> isOrdered(rowCount, 0);
+
+    // 각 node의 차수(자기 자신을 제외한 연결된 node의 수)
+    for (long long int i = 0; i < rowCount; i++)
+    {
+        degree[i] = matrixCSR.rowPtr[i + 1] - matrixCSR.rowPtr[i];
+        for (long long int cursor = matrixCSR.rowPtr[i]; cursor < matrixCSR.rowPtr[i + 1]; cursor++)
+        {
+            if (matrixCSR.colIdx[cursor] == i)
+            {
+                degree[i]--;
+            }
+        }
+    }
+
+    // 너비 우선 탐색으로 start에서 각 node까지의 거리를 level에 저장하고, 방문한 순서를 출력한다.
+    auto searchLevel = [&](long long int start) {
+        std::vector<long long int> visit(1, start);
+        level[start] = 0;
+        for (unsigned long long int k = 0; k < visit.size(); k++)
+        {
+            long long int node = visit[k];
+            for (long long int cursor = matrixCSR.rowPtr[node]; cursor < matrixCSR.rowPtr[node + 1]; cursor++)
+            {
+                if (level[matrixCSR.colIdx[cursor]] == -1)
+                {
+                    level[matrixCSR.colIdx[cursor]] = level[node] + 1;
+                    visit.push_back(matrixCSR.colIdx[cursor]);
+                }
+            }
+        }
+        return visit;
+    };
+
+    // 차수가 작은 node부터, 아직 번호를 매기지 않은 연결된 부분마다 반복
+    std::vector<long long int> candidate(rowCount);
+    for (long long int i = 0; i < rowCount; i++)
+    {
+        candidate[i] = i;
+    }
+    std::stable_sort(candidate.begin(), candidate.end(), [&](long long int x, long long int y) {
+        return degree[x] < degree[y];
+    });
+
+    for (long long int c = 0; c < rowCount; c++)
+    {
+        long long int start = candidate[c];
+        if (isOrdered[start])
+        {
+            continue;
+        }
+
+        // 가장 먼 node 중 차수가 가장 작은 node로 시작점을 옮기며, 더 멀어지지 않을 때까지 반복한다. (George-Liu 방식)
+        std::vector<long long int> visit = searchLevel(start);
+        long long int eccentricity = level[visit.back()];
+        while (true)
+        {
+            long long int next = visit.back();
+            for (long long int k = visit.size() - 1; k >= 0 && level[visit[k]] == eccentricity; k--)
+            {
+                if (degree[visit[k]] < degree[next])
+                {
+                    next = visit[k];
+                }
+            }
+            for (unsigned long long int k = 0; k < visit.size(); k++)
+            {
+                level[visit[k]] = -1;
+            }
+
+            std::vector<long long int> nextVisit = searchLevel(next);
+            if (level[nextVisit.back()] <= eccentricity)
+            {
+                for (unsigned long long int k = 0; k < nextVisit.size(); k++)
+                {
+                    level[nextVisit[k]] = -1;
+                }
+                break;
+            }
+            start = next;
+            visit = std::move(nextVisit);
+            eccentricity = level[visit.back()];
+        }
+
+        // 시작점부터, 연결된 node를 차수가 작은 순서로 번호를 매긴다. (Cuthill-McKee)
+        unsigned long long int head = order.size();
+        order.push_back(start);
+        isOrdered[start] = 1;
+        std::vector<long long int> neighbor;
+        for (; head < order.size(); head++)
+        {
+            long long int node = order[head];
+            neighbor.clear();
+            for (long long int cursor = matrixCSR.rowPtr[node]; cursor < matrixCSR.rowPtr[node + 1]; cursor++)
+            {
+                if (!isOrdered[matrixCSR.colIdx[cursor]])
+                {
+                    isOrdered[matrixCSR.colIdx[cursor]] = 1;
+                    neighbor.push_back(matrixCSR.colIdx[cursor]);
+                }
+            }
+            std::stable_sort(neighbor.begin(), neighbor.end(), [&](long long int x, long long int y) {
+                return degree[x] < degree[y];
+            });
+            order.insert(order.end(), neighbor.begin(), neighbor.end());
+        }
+    }
+
+    // 순서를 뒤집는다. (Reverse)
+    std::reverse(order.begin(), order.end());
+
+    return order;
+}
+
+/* measureBandwidth() 함수
+*
+* 기능: 주어진 순서로 행과 열을 바꾼 Y-Matrix의 bandwidth(대각선에서 가장 먼 값까지의 거리)와
+*       profile(각 행에서 첫 번째 값부터 대각선까지의 거리의 합)을 구한다.
+* 입력값: matrixCSR, order(새로운 순서대로 나열한 CSR의 행의 위치), bandwidth, profile(결과를 저장할 변수)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void measureBandwidth(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& order, long long int& bandwidth, long long int& profile)
+{
+    std::vector<long long int> position(matrixCSR.nodeNum.size());
+    for (unsigned long long int i = 0; i < order.size(); i++)
+    {
+        position[order[i]] = i;
+    }
+
+    bandwidth = 0;
+    profile = 0;
+    for (unsigned long long int row = 0; row < matrixCSR.nodeNum.size(); row++)
+    {
+        long long int first = position[row];
+        for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+        {
+            long long int distance = position[row] - position[matrixCSR.colIdx[cursor]];
+            bandwidth = std::max(bandwidth, distance < 0 ? -distance : distance);
+            first = std::min(first, position[matrixCSR.colIdx[cursor]]);
+        }
+        profile += position[row] - first;
+    }
+
+    return;
+}
+
+/* writePermutation() 함수
+*
+* 기능: 출력한 행렬의 행과 열의 순서를 order,node 형식의 CSV 파일로 저장한다. (order는 1부터)
+* 입력값: filePath, busNum(출력한 순서대로 나열한 node 번호)
+* 출력값: 성공 여부(파일을 열 수 없거나, 쓰기 또는 닫기에 실패한 경우 거짓)
+* 최종 수정일: 2026/10/17
+*/
+bool writePermutation(const std::string& filePath, const std::vector<long long int>& busNum)
+{
+    FILE* permFile = fopen(filePath.c_str(), "wb");
+    if (permFile == NULL)
+    {
+        return false;
+    }
+
+    bool isWritten;
+    {
+        Output_Writer writer(permFile);
+
+        writer.writeText("order,node\n");
+        for (unsigned long long int i = 0; i < busNum.size(); i++)
+        {
+            writer.writeInt(i + 1);
+            writer.writeChar(',');
+            writer.writeInt(busNum[i]);
+            writer.writeChar('\n');
+        }
+        writer.flush();
+        isWritten = !writer.failed();
+    }
+    isWritten = (fclose(permFile) == 0) && isWritten;
+
+    return isWritten;
+}
+
+#if Y_MATRIX_STATS
+/* writeStats() 함수
+*
+* 기능: 기록한 counter와 단계별 걸린 시간(ns)을 JSON 형식으로 출력한다.
+*       main thread의 counter는 아직 합계에 더해지지 않았으므로 함께 더한다. (다른 thread가 모두 끝난 뒤 호출한다.)
+* 입력값: writer
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void writeStats(Output_Writer& writer)
+{
+    const char* counterName[STAT_COUNTER_COUNT] = { "lookups", "probes", "inserts", "erases", "erase_shifts", "rehashes", "row_searches", "bytes_parsed", "lines_parsed", "bytes_output",
+        "stream_events", "scenarios", "serve_requests" };
+    const char* phaseName[STAT_PHASE_COUNT] = { "read", "parse", "assembly", "freeze", "kron", "reorder", "analysis", "output", "stream", "scenarios", "serve" };
+
+    writer.writeText("{\n  \"counters\": {\n");
+    for (int i = 0; i < STAT_COUNTER_COUNT; i++)
+    {
+        writer.writeText("    \"");
+        writer.writeText(counterName[i]);
+        writer.writeText("\": ");
+        writer.writeInt(statsTotal[i].load() + statsCounter.value[i]);
+        writer.writeText(i + 1 < STAT_COUNTER_COUNT ? ",\n" : "\n");
+    }
+    writer.writeText("  },\n  \"phases_ns\": {\n");
+    for (int i = 0; i < STAT_PHASE_COUNT; i++)
+    {
+        writer.writeText("    \"");
+        writer.writeText(phaseName[i]);
+        writer.writeText("\": ");
+        writer.writeInt(statsPhaseNs[i]);
+        writer.writeText(i + 1 < STAT_PHASE_COUNT ? ",\n" : "\n");
+    }
+    writer.writeText("  }\n}\n");
+
+    return;
+}
+
+/* saveStats() 함수
+*
+* 기능: 실행 통계를 주어진 파일(빈 문자열이면 표준 오류)에 출력한다.
+* 입력값: statsPath
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool saveStats(const std::string& statsPath)
+{
+    FILE* statsFile = statsPath.empty() ? stderr : fopen(statsPath.c_str(), "wb");
+    if (statsFile == NULL)
+    {
+        std::cout << "Cannot Open Statistics File" << std::endl;
+        return false;
+    }
+    {
+        Output_Writer statsWriter(statsFile);
+        writeStats(statsWriter);
+    }
+    if (statsFile != stderr)
+    {
+        fclose(statsFile);
+    }
+
+    return true;
+}
+#endif
+
+/* parseNodeValueFile() 함수
+*
+* 기능: 입력 파일의 내용을 한 줄씩 읽어, (Node) (실수값) ... 형식의 값을 읽는다. 빈 줄은 무시한다.
+* 입력값: fileData, fileLength(읽을 내용과 길이), valueCount(node 뒤에 오는 실수값의 수), node, value(읽은 값을 저장할 vector), errorMessage
+* 출력값: 모든 줄을 읽은 경우 참을, 형식에 맞지 않는 줄이 있는 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool parseNodeValueFile(const char* fileData, unsigned long long int fileLength, int valueCount, std::vector<long long int>& node, std::vector<long double>& value, std::string& errorMessage)
+{
+    const char* cursor = fileData;
+    const char* fileEnd = fileData + fileLength;
+    long long int lineNumber = 0;
+
+    while (cursor < fileEnd)
+    {
+        const char* lineEnd = (const char*)memchr(cursor, '\n', fileEnd - cursor);
+        if (lineEnd == NULL)
+        {
+            lineEnd = fileEnd;
+        }
+        lineNumber++;
+
+        // 줄의 값을 차례대로 읽는다.
+        const char* fieldCursor = cursor;
+        int fieldCount = 0;
+        bool isValid = true;
+        while (isValid)
+        {
+            while (fieldCursor < lineEnd && (*fieldCursor == ' ' || *fieldCursor == '\t' || *fieldCursor == '\r'))
+            {
+                fieldCursor++;
+            }
+            if (fieldCursor == lineEnd)
+            {
+                break;
+            }
+            if (fieldCount > valueCount)
+            {
+                isValid = false;
+                break;
+            }
+            fieldCursor = skipPlusSign(fieldCursor, lineEnd);
+
+            std::from_chars_result result;
+            if (fieldCount == 0)
+            {
+                long long int nodeVal;
+                result = std::from_chars(fieldCursor, lineEnd, nodeVal);
+                if (result.ec == std::errc())
+                {
+                    node.push_back(nodeVal);
+                }
+            }else{
+                long double realVal;
+                result = parseRealValue(fieldCursor, lineEnd, realVal);
+                if (result.ec == std::errc())
+                {
+                    value.push_back(realVal);
+                }
+            }
+            if (result.ec != std::errc() || (result.ptr < lineEnd && *result.ptr != ' ' && *result.ptr != '\t' && *result.ptr != '\r'))
+            {
+                isValid = false;
+                break;
+            }
+            fieldCursor = result.ptr;
+            fieldCount++;
+        }
+
+        // 형식에 맞지 않는 경우, 줄 번호와 해당 줄의 내용을 기록한다. (빈 줄은 무시한다.)
+        if (!isValid || (fieldCount != 0 && fieldCount != valueCount + 1))
+        {
+            const char* textEnd = (lineEnd > cursor && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+            errorMessage = "Line " + std::to_string(lineNumber) + ": Invalid Format (" + std::string(cursor, textEnd) + ")";
+            return false;
+        }
+
+        cursor = lineEnd + 1;
+    }
+
+    return true;
+}
+
+/* collectNodes() 함수
+*
+* 기능: 선로와 소자, 추가로 주어진 node 번호를 모아 중복을 제거하고 오름차순으로 정렬한다. (출력 시 행과 열의 순서)
+*       node 번호의 범위가 node 수에 비해 좁은 경우, 정렬 대신 범위 크기의 표시 배열로 중복을 제거한다.
+*       node 번호가 크고 띄엄띄엄한 경우에도, 출력과 반복의 크기가 실제 node의 수(N)에 비례하도록 한다.
+* 입력값: branch, device, extraNode(함께 포함할 node 번호, Binary 파일의 Y-Matrix 행 번호 등)
+* 출력값: 정렬된 node 번호
+* 최종 수정일: 2026/10/17
+*/
+std::vector<long long int> collectNodes(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, const std::vector<long long int>& extraNode)
+{
+    std::vector<long long int> node;
+
+    node.reserve(branch.size() * 2 + device.size() * 2 + extraNode.size());
+    for (const Branch_Val& branchVal : branch)
+    {
+        node.push_back(branchVal.node1);
+        node.push_back(branchVal.node2);
+    }
+    for (const Device_Val& deviceVal : device)
+    {
+        node.push_back(deviceVal.node1);
+        node.push_back(deviceVal.node2);
+    }
+    node.insert(node.end(), extraNode.begin(), extraNode.end());
+    if (node.empty())
+    {
+        return node;
+    }
+
+    // node 번호의 범위가 좁은 경우, 정렬하지 않고 나온 번호를 표시한 뒤 차례대로 읽는다.
+    auto [minNode, maxNode] = std::minmax_element(node.begin(), node.end());
+    unsigned long long int range = (unsigned long long int)*maxNode - (unsigned long long int)*minNode;
+    if (range < node.size() * 4)
+    {
+        long long int offset = *minNode;
+        std::vector<char> isUsed(range + 1, false);
+        for (long long int nodeNum : node)
+        {
+            isUsed[nodeNum - offset] = true;
+        }
+        node.clear();
+        for (unsigned long long int i = 0; i <= range; i++)
+        {
+            if (isUsed[i])
+            {
+                node.push_back(offset + (long long int)i);
+            }
+        }
+    }else{
+        std::sort(node.begin(), node.end());
+        node.erase(std::unique(node.begin(), node.end()), node.end());
+    }
+
+    return node;
+}
+
+/* readNodeFile() 함수
+*
+* 기능: node의 목록(Kron 축약에서 남길 node, 고장 node 등)을 파일에서 읽는다. 파일의 양식은 한 줄에 (Node) 하나이며, 빈 줄은 무시한다.
+*       같은 node가 여러 번 나온 경우, 처음 나온 것만 남긴다.
+* 입력값: filePath(파일의 위치), fileType(오류 메시지에 사용할 파일의 종류), inputNode(입력 파일에 나온 node 번호, 오름차순), node(읽은 node 번호를 파일의 순서대로 저장할 vector)
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool readNodeFile(const std::string& filePath, const std::string& fileType, const std::vector<long long int>& inputNode, std::vector<long long int>& node)
+{
+    Mapped_File nodeFile;
+    std::vector<long double> unusedValue;
+    std::string errorMessage;
+
+    if (!nodeFile.open(filePath))
+    {
+        std::cout << fileType << " File Not Found" << std::endl;
+        return false;
+    }
+    if (!parseNodeValueFile(nodeFile.data(), nodeFile.size(), 0, node, unusedValue, errorMessage))
+    {
+        std::cout << "Invalid " << fileType << " File - " << errorMessage << std::endl;
+        return false;
+    }
+    nodeFile.close();
+
+    for (unsigned long long int i = 0; i < node.size(); i++)
+    {
+        if (!std::binary_search(inputNode.begin(), inputNode.end(), node[i]))
+        {
+            std::cout << "Unknown Node in " << fileType << " File: " << node[i] << std::endl;
+            return false;
+        }
+    }
+
+    // 파일의 순서를 유지하며 중복을 제거한다.
+    std::vector<char> isRead(inputNode.size(), false);
+    unsigned long long int uniqueCount = 0;
+    for (unsigned long long int i = 0; i < node.size(); i++)
+    {
+        long long int position = std::lower_bound(inputNode.begin(), inputNode.end(), node[i]) - inputNode.begin();
+        if (!isRead[position])
+        {
+            isRead[position] = true;
+            node[uniqueCount++] = node[i];
+        }
+    }
+    node.resize(uniqueCount);
+
+    return true;
+}
@@ -0,0 +1,136 @@
+﻿/* io.hpp
+*
+* 입력 파일 읽기(Mapped_File)와 해석, 출력(Output_Writer)과 Y-Matrix의 출력 형식(dense, MatrixMarket, CSV), 행과 열의 순서 변경
+*/
+#ifndef Y_MATRIX_IO_HPP
+#define Y_MATRIX_IO_HPP
+
+#include<string>
+#include<vector>
+#include<cstdio>
+#include<charconv>
+
+#ifdef _WIN32
+#include<windows.h>
+#endif
+
+#include "y_matrix.hpp"
+
+/* Mapped_File 클래스
+*
+* 기능: 파일을 memory-mapped file로 열어, 파일의 내용을 복사 없이 읽을 수 있도록 한다.
+* 최종 수정일: 2026/10/17
+*/
+class Mapped_File{
+private:
+    // 파일의 내용이 위치한 주소와 파일의 길이
+    const char* fileData;
+    unsigned long long int fileLength;
+
+#ifdef _WIN32
+    HANDLE fileHandle, mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+
+public:
+Mapped_File();
+~Mapped_File();
+
+bool open(const std::string& filePath);
+
+void close();
+
+const char* data() const;
+
+unsigned long long int size() const;
+
+};
+
+/* Output_Writer 클래스
+*
+* 기능: iostream을 사용하지 않고, 출력할 문자열을 buffer에 모아 한 번에 파일로 출력한다.
+*       파일에 다 쓰지 못한 경우(디스크 공간 부족 등) 이를 기록해 두며, failed()로 확인한다.
+* 최종 수정일: 2026/10/17
+*/
+class Output_Writer{
+private:
+    // 출력할 파일
+    FILE* outputFile;
+
+    // 출력할 문자열을 모아두는 buffer와, buffer에서 사용중인 길이
+    std::vector<char> buffer;
+    unsigned long long int used;
+
+    // 파일에 다 쓰지 못한 적이 있는지 여부
+    bool isWriteFailed;
+
+    void reserveBuffer(unsigned long long int length);
+
+public:
+Output_Writer(FILE* file);
+~Output_Writer();
+
+void writeText(const char* text);
+
+void writeChar(char character);
+
+void writeInt(long long int value);
+
+void writeReal(long double value);
+
+void writeReal(double value);
+
+void writeFixed(long double value, int precision, int width);
+
+void flush();
+
+bool failed() const;
+
+};
+
+/* skipPlusSign() 함수
+*
+* 기능: std::from_chars는 '+' 부호를 읽지 않으므로, 값 앞의 '+'를 넘긴다.
+*       '+' 뒤에 다시 부호가 있는 경우('+-0.5' 등)는 넘기지 않아, 값을 읽을 때 오류가 되도록 한다.
+* 입력값: cursor(값의 시작 위치), last(읽을 문자열의 끝)
+* 출력값: 값을 읽기 시작할 위치
+* 최종 수정일: 2026/10/17
+*/
+inline const char* skipPlusSign(const char* cursor, const char* last)
+{
+    if (cursor + 1 < last && *cursor == '+' && cursor[1] != '+' && cursor[1] != '-')
+    {
+        return cursor + 1;
+    }
+
+    return cursor;
+}
+
+std::from_chars_result parseRealValue(const char* first, const char* last, long double& value);
+
+bool parseBranchFile(const char* fileData, unsigned long long int fileLength, std::vector<Branch_Val>& branch, std::string& errorMessage, std::vector<Device_Val>* device = NULL);
+
+bool parseNodeValueFile(const char* fileData, unsigned long long int fileLength, int valueCount, std::vector<long long int>& node, std::vector<long double>& value, std::string& errorMessage);
+
+std::vector<long long int> collectNodes(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, const std::vector<long long int>& extraNode);
+
+bool readNodeFile(const std::string& filePath, const std::string& fileType, const std::vector<long long int>& inputNode, std::vector<long long int>& node);
+
+void writeDenseMatrix(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, Output_Writer& writer);
+
+void writeMatrixMarket(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, Output_Writer& writer);
+
+void writeTripletCSV(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& busNum, Output_Writer& writer);
+
+std::vector<long long int> reorderRCM(const Y_Matrix_CSR& matrixCSR);
+
+void measureBandwidth(const Y_Matrix_CSR& matrixCSR, const std::vector<long long int>& order, long long int& bandwidth, long long int& profile);
+
+bool writePermutation(const std::string& filePath, const std::vector<long long int>& busNum);
+
+#if Y_MATRIX_STATS
+bool saveStats(const std::string& statsPath);
+#endif
+
+#endif // Y_MATRIX_IO_HPP
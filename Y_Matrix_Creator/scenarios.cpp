@@ -0,0 +1,43 @@
+﻿#include "scenarios.hpp"
+
+/* buildScenarioPattern() 함수
+*
+* 기능: 선로 정보에서 Y-Matrix의 구조와 각 선로가 값을 더하는 위치를 한 번만 구한다.
+* 입력값: branch, pattern
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void buildScenarioPattern(const std::vector<Branch_Val>& branch, Scenario_Pattern& pattern)
+{
+    std::vector<Y_Matrix_Val<>> entry;
+
+    // 선로마다 값이 더해지는 위치(node1 <= node2)를 모은 뒤, 중복을 제거한다.
+    entry.reserve(branch.size() * 3);
+    for (const Branch_Val& branchVal : branch)
+    {
+        long long int Node1 = std::min(branchVal.node1, branchVal.node2), Node2 = std::max(branchVal.node1, branchVal.node2);
+        entry.push_back({ Node1, Node1, 0, 0 });
+        entry.push_back({ Node2, Node2, 0, 0 });
+        entry.push_back({ Node1, Node2, 0, 0 });
+    }
+    std::sort(entry.begin(), entry.end(), [](const Y_Matrix_Val<>& a, const Y_Matrix_Val<>& b) {
+        return a.node1 != b.node1 ? a.node1 < b.node1 : a.node2 < b.node2;
+    });
+    entry.erase(std::unique(entry.begin(), entry.end(), [](const Y_Matrix_Val<>& a, const Y_Matrix_Val<>& b) {
+        return a.node1 == b.node1 && a.node2 == b.node2;
+    }), entry.end());
+    pattern.matrix = buildCSR(entry);
+
+    // 각 선로가 값을 더하는 위치를 찾는다.
+    pattern.branchEntry.resize(branch.size() * 4);
+    for (unsigned long long int i = 0; i < branch.size(); i++)
+    {
+        long long int Node1 = std::min(branch[i].node1, branch[i].node2), Node2 = std::max(branch[i].node1, branch[i].node2);
+        pattern.branchEntry[i * 4] = pattern.matrix.findEntry(Node1, Node1);
+        pattern.branchEntry[i * 4 + 1] = pattern.matrix.findEntry(Node2, Node2);
+        pattern.branchEntry[i * 4 + 2] = Node1 == Node2 ? -1 : pattern.matrix.findEntry(Node1, Node2);
+        pattern.branchEntry[i * 4 + 3] = Node1 == Node2 ? -1 : pattern.matrix.findEntry(Node2, Node1);
+    }
+
+    return;
+}
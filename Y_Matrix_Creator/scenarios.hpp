@@ -0,0 +1,383 @@
+﻿/* scenarios.hpp
+*
+* 구조가 같고 선로의 값만 다른 여러 시나리오의 Y-Matrix 구성(--scenarios 옵션)
+*/
+#ifndef Y_MATRIX_SCENARIOS_HPP
+#define Y_MATRIX_SCENARIOS_HPP
+
+#include<vector>
+#include<string>
+#include<iostream>
+#include<iomanip>
+#include<thread>
+#include<atomic>
+#include<mutex>
+#include<cstring>
+
+#include "io.hpp"
+#include "binary_format.hpp"
+
+/* 시나리오 Binary 파일 형식
+*
+* 모든 값은 little-endian이며, 실수는 IEEE 754 64bit(double)로 저장한다.
+* Header(64 Byte): magic("YMATSCN\0", 8 Byte), version(4 Byte), header 길이(4 Byte), 시나리오 수, 행의 수, 0이 아닌 값의 수,
+*                  checksum(Header 뒤의 모든 내용의 FNV-1a 64bit 값), 예약(0) 2개 (각 8 Byte)
+* 구조(CSR 형태): nodeNum(행의 수), rowPtr(행의 수 + 1), colIdx(0이 아닌 값의 수) (각 8 Byte씩)
+* 시나리오마다: 시나리오 번호(8 Byte), G, jB(0이 아닌 값의 수) (각 8 Byte씩)
+* 모든 시나리오가 같은 구조를 사용하므로, 어떤 시나리오에서 0이 된 값도 구조에 남는다.
+*/
+const char SCENARIO_MAGIC[8] = { 'Y', 'M', 'A', 'T', 'S', 'C', 'N', '\0' };
+const uint32_t SCENARIO_VERSION = 1;
+
+// 한 번에 계산하는 시나리오의 수(thread 1개당)
+const long long int SCENARIO_CHUNK_PER_THREAD = 4;
+
+/* Scenario_Pattern 구조체
+*
+* 기능: 모든 시나리오가 공유하는 Y-Matrix의 구조(CSR 형태, 값은 저장하지 않는다.)와,
+*       각 선로가 값을 더하는 4개의 위치((node1, node1), (node2, node2), (node1, node2), (node2, node1), 같은 node를 잇는 선로는 뒤의 2개가 -1)를 저장한다.
+* 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    Y_Matrix_CSR matrix;
+    std::vector<long long int> branchEntry;
+} Scenario_Pattern;
+
+void buildScenarioPattern(const std::vector<Branch_Val>& branch, Scenario_Pattern& pattern);
+
+/* fillScenario() 함수
+*
+* 기능: 하나의 시나리오의 R, L, C로 어드미턴스를 한 번에 계산하여, 정해진 위치에 선로 순서대로 더한다. (검색과 정렬을 하지 않는다.)
+*       더하는 도중 값이 0이 된 경우 다음 값으로 바꾸어, reduceMatrix()(addMatrixPackage()를 차례대로 호출한 결과)와 같은 값을 얻는다.
+*       같은 node를 잇는 선로는 addMatrixPackage()와 같이 대각 성분에 3번 더한다.
+* 입력값: pattern, R, X, C(선로 순서대로의 값), seriesG, seriesB, diagB(계산에 사용할 공간), G, jB(계산한 값을 저장할 공간, 길이는 0이 아닌 값의 수)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+void fillScenario(const Scenario_Pattern& pattern, const std::vector<T>& R, const std::vector<T>& X, const std::vector<T>& C,
+    std::vector<T>& seriesG, std::vector<T>& seriesB, std::vector<T>& diagB, std::vector<T>& G, std::vector<T>& jB)
+{
+    // 합이 0이 된 경우 값을 지운 뒤 새로 저장하는 것과 같이 처리한다.
+    auto addEntry = [&G, &jB](long long int location, T realVal, T imagVal)
+    {
+        if (G[location] == 0 && jB[location] == 0)
+        {
+            G[location] = realVal;
+            jB[location] = imagVal;
+        }else{
+            G[location] += realVal;
+            jB[location] += imagVal;
+        }
+    };
+
+    calcAdmittanceBatch(R.size(), R.data(), X.data(), C.data(), seriesG.data(), seriesB.data(), diagB.data());
+
+    std::fill(G.begin(), G.end(), 0);
+    std::fill(jB.begin(), jB.end(), 0);
+    for (unsigned long long int i = 0; i < R.size(); i++)
+    {
+        const long long int* location = &pattern.branchEntry[i * 4];
+
+        addEntry(location[0], seriesG[i], diagB[i]);
+        addEntry(location[1], seriesG[i], diagB[i]);
+        if (location[2] == -1)
+        {
+            addEntry(location[0], seriesG[i], diagB[i]);
+        }else{
+            addEntry(location[2], -seriesG[i], -seriesB[i]);
+            addEntry(location[3], -seriesG[i], -seriesB[i]);
+        }
+    }
+
+    return;
+}
+
+/* writeScenarioFile() 함수
+*
+* 기능: 하나의 시나리오의 Y-Matrix를 주어진 형식(dense, mtx, csv)으로 파일에 출력한다. 0인 값은 구조에서 빼고 출력한다.
+* 입력값: filePath, outputFormat, pattern, busNum, G, jB
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+bool writeScenarioFile(const std::string& filePath, const std::string& outputFormat, const Scenario_Pattern& pattern, const std::vector<long long int>& busNum, const std::vector<T>& G, const std::vector<T>& jB)
+{
+    Y_Matrix_CSR matrixCSR;
+    FILE* outputFile = fopen(filePath.c_str(), "wb");
+
+    if (outputFile == NULL)
+    {
+        return false;
+    }
+
+    // 0이 아닌 값만을 남긴 CSR 형태의 Y-Matrix를 만든다. (행은 모두 남긴다.)
+    matrixCSR.nodeNum = pattern.matrix.nodeNum;
+    matrixCSR.rowPtr.push_back(0);
+    for (unsigned long long int row = 0; row < pattern.matrix.nodeNum.size(); row++)
+    {
+        for (long long int cursor = pattern.matrix.rowPtr[row]; cursor < pattern.matrix.rowPtr[row + 1]; cursor++)
+        {
+            if (G[cursor] != 0 || jB[cursor] != 0)
+            {
+                matrixCSR.colIdx.push_back(pattern.matrix.colIdx[cursor]);
+                matrixCSR.G.push_back(G[cursor]);
+                matrixCSR.jB.push_back(jB[cursor]);
+            }
+        }
+        matrixCSR.rowPtr.push_back(matrixCSR.colIdx.size());
+    }
+
+    {
+        Output_Writer writer(outputFile);
+
+        if (outputFormat == "mtx")
+        {
+            writeMatrixMarket(matrixCSR, busNum, writer);
+        }else if (outputFormat == "csv")
+        {
+            writeTripletCSV(matrixCSR, busNum, writer);
+        }else{
+            writeDenseMatrix(matrixCSR, busNum, writer);
+        }
+    }
+    fclose(outputFile);
+
+    return true;
+}
+
+/* buildScenarios() 함수
+*
+* 기능: 하나의 계통 구조와 시나리오 파일(시나리오마다 바뀌는 선로의 R, L, C)로, 모든 시나리오의 Y-Matrix를 구성한다.
+*       구조와 각 선로의 위치는 한 번만 구하며, 시나리오마다 fillScenario()로 값만 계산한다.
+*       여러 thread가 SCENARIO_CHUNK_PER_THREAD개씩의 시나리오를 나누어 계산하며,
+*       splitPath가 주어진 경우 각 thread가 시나리오마다 (splitPath)/scenario_(번호) 파일을 주어진 형식으로 출력하고,
+*       그렇지 않은 경우 모든 시나리오를 시나리오 번호 순서로 하나의 시나리오 Binary 파일(outputPath)에 저장한다.
+* 입력값: branch, busNum, scenarioPath, threadCount, outputPath, splitPath, outputFormat
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+bool buildScenarios(const std::vector<Branch_Val>& branch, const std::vector<long long int>& busNum, const std::string& scenarioPath, int threadCount,
+    const std::string& outputPath, const std::string& splitPath, const std::string& outputFormat)
+{
+    Mapped_File scenarioFile;
+    std::vector<Branch_Val> parameter; // 시나리오 파일의 각 줄((Scenario) (Branch) (R) (L) (C)를 node1, node2, R, L, C에 저장한다.)
+    std::string errorMessage;
+
+    if (splitPath.empty() && outputPath.empty())
+    {
+        std::cout << "Scenario Output File Not Given" << std::endl;
+        return false;
+    }
+    if (!scenarioFile.open(scenarioPath))
+    {
+        std::cout << "Scenario File Not Found" << std::endl;
+        return false;
+    }
+    if (!parseBranchFile(scenarioFile.data(), scenarioFile.size(), parameter, errorMessage))
+    {
+        std::cout << "Invalid Scenario File - " << errorMessage << std::endl;
+        return false;
+    }
+    scenarioFile.close();
+    for (const Branch_Val& parameterVal : parameter)
+    {
+        if (parameterVal.node2 < 1 || parameterVal.node2 > (long long int)branch.size())
+        {
+            std::cout << "Unknown Branch in Scenario File: " << parameterVal.node2 << std::endl;
+            return false;
+        }
+    }
+
+    // 시나리오 번호 순서로 정렬하고(같은 시나리오 안에서는 파일의 순서), 각 시나리오의 시작 위치를 기록한다.
+    std::stable_sort(parameter.begin(), parameter.end(), [](const Branch_Val& a, const Branch_Val& b) { return a.node1 < b.node1; });
+    std::vector<unsigned long long int> scenarioStart;
+    for (unsigned long long int i = 0; i < parameter.size(); i++)
+    {
+        if (i == 0 || parameter[i].node1 != parameter[i - 1].node1)
+        {
+            scenarioStart.push_back(i);
+        }
+    }
+    long long int scenarioCount = scenarioStart.size();
+    scenarioStart.push_back(parameter.size());
+
+    // 구조와 각 선로의 위치를 한 번만 구한다.
+    auto startTime = std::chrono::steady_clock::now();
+    Scenario_Pattern pattern;
+    buildScenarioPattern(branch, pattern);
+    double patternTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    unsigned long long int rowCount = pattern.matrix.nodeNum.size(), entryCount = pattern.matrix.colIdx.size();
+
+    // 기본 R, L, C
+    std::vector<T> baseR(branch.size()), baseX(branch.size()), baseC(branch.size());
+    for (unsigned long long int i = 0; i < branch.size(); i++)
+    {
+        baseR[i] = branch[i].R;
+        baseX[i] = branch[i].L;
+        baseC[i] = branch[i].C;
+    }
+
+    // 시나리오 Binary 파일을 여는 경우, Header 자리를 비워 두고 구조를 저장한다.
+    FILE* outputFile = NULL;
+    uint64_t checksum = 0xCBF29CE484222325ULL;
+    std::vector<unsigned char> fileBuffer;
+    if (splitPath.empty())
+    {
+        outputFile = fopen(outputPath.c_str(), "wb");
+        if (outputFile == NULL)
+        {
+            std::cout << "Cannot Open Output File" << std::endl;
+            return false;
+        }
+
+        fileBuffer.assign(BINARY_HEADER_SIZE + (rowCount * 2 + 1 + entryCount) * 8, 0);
+        unsigned char* cursor = fileBuffer.data() + BINARY_HEADER_SIZE;
+        for (unsigned long long int i = 0; i < rowCount; i++, cursor += 8)
+        {
+            storeLE64(cursor, pattern.matrix.nodeNum[i]);
+        }
+        for (unsigned long long int i = 0; i <= rowCount; i++, cursor += 8)
+        {
+            storeLE64(cursor, pattern.matrix.rowPtr[i]);
+        }
+        for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+        {
+            storeLE64(cursor, pattern.matrix.colIdx[i]);
+        }
+        checksum = checksumFNV(fileBuffer.data() + BINARY_HEADER_SIZE, fileBuffer.size() - BINARY_HEADER_SIZE, checksum);
+    }
+
+    // SCENARIO_CHUNK_PER_THREAD * threadCount개의 시나리오씩, 여러 thread가 나누어 계산한다.
+    long long int chunkSize = SCENARIO_CHUNK_PER_THREAD * threadCount;
+    std::vector<std::vector<T>> chunkG(chunkSize, std::vector<T>(entryCount)), chunkJB(chunkSize, std::vector<T>(entryCount));
+    std::atomic<bool> isFailed(splitPath.empty() && fwrite(fileBuffer.data(), 1, fileBuffer.size(), outputFile) != fileBuffer.size());
+    double fillTime = 0, writeTime = 0;
+
+    // 저장에 실패한 경우, 남은 시나리오는 계산하지 않는다.
+    for (long long int chunkStart = 0; chunkStart < scenarioCount && !isFailed; chunkStart += chunkSize)
+    {
+        long long int chunkEnd = std::min(chunkStart + chunkSize, scenarioCount);
+        std::atomic<long long int> nextScenario(chunkStart);
+
+        // 각 thread는 남은 시나리오를 하나씩 가져가 계산한다.
+        auto fillWorker = [&]()
+        {
+            std::vector<T> R, X, C, seriesG(branch.size()), seriesB(branch.size()), diagB(branch.size());
+
+            for (long long int scenario = nextScenario++; scenario < chunkEnd; scenario = nextScenario++)
+            {
+                long long int slot = scenario - chunkStart;
+                STATS_ADD(STAT_SCENARIO, 1);
+
+                // 기본값에 해당 시나리오의 값을 덮어쓴다.
+                R = baseR;
+                X = baseX;
+                C = baseC;
+                for (unsigned long long int i = scenarioStart[scenario]; i < scenarioStart[scenario + 1]; i++)
+                {
+                    R[parameter[i].node2 - 1] = parameter[i].R;
+                    X[parameter[i].node2 - 1] = parameter[i].L;
+                    C[parameter[i].node2 - 1] = parameter[i].C;
+                }
+                fillScenario(pattern, R, X, C, seriesG, seriesB, diagB, chunkG[slot], chunkJB[slot]);
+
+                // 시나리오마다 파일을 출력하는 경우, 계산한 thread에서 바로 출력한다.
+                if (!splitPath.empty())
+                {
+                    std::string extension = outputFormat == "mtx" ? ".mtx" : (outputFormat == "csv" ? ".csv" : ".txt");
+                    std::string filePath = splitPath + "/scenario_" + std::to_string(parameter[scenarioStart[scenario]].node1) + extension;
+                    if (!writeScenarioFile(filePath, outputFormat, pattern, busNum, chunkG[slot], chunkJB[slot]))
+                    {
+                        isFailed = true;
+                    }
+                }
+            }
+        };
+
+        startTime = std::chrono::steady_clock::now();
+        std::vector<std::thread> worker;
+        for (int i = 1; i < threadCount && i < chunkEnd - chunkStart; i++)
+        {
+            worker.emplace_back(fillWorker);
+        }
+        fillWorker();
+        for (std::thread& thread : worker)
+        {
+            thread.join();
+        }
+        fillTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        // 시나리오 Binary 파일에는 시나리오 번호 순서로 저장한다.
+        if (splitPath.empty())
+        {
+            startTime = std::chrono::steady_clock::now();
+            fileBuffer.resize((entryCount * 2 + 1) * 8);
+            for (long long int scenario = chunkStart; scenario < chunkEnd; scenario++)
+            {
+                long long int slot = scenario - chunkStart;
+                unsigned char* cursor = fileBuffer.data();
+
+                storeLE64(cursor, parameter[scenarioStart[scenario]].node1);
+                cursor += 8;
+                for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+                {
+                    storeLE64(cursor, std::bit_cast<uint64_t>((double)chunkG[slot][i]));
+                }
+                for (unsigned long long int i = 0; i < entryCount; i++, cursor += 8)
+                {
+                    storeLE64(cursor, std::bit_cast<uint64_t>((double)chunkJB[slot][i]));
+                }
+                checksum = checksumFNV(fileBuffer.data(), fileBuffer.size(), checksum);
+                if (fwrite(fileBuffer.data(), 1, fileBuffer.size(), outputFile) != fileBuffer.size())
+                {
+                    isFailed = true;
+                    break;
+                }
+            }
+            writeTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        }
+    }
+
+    // 시나리오 Binary 파일의 Header를 저장한다.
+    if (splitPath.empty())
+    {
+        unsigned char header[BINARY_HEADER_SIZE] = {};
+        uint32_t version = SCENARIO_VERSION, headerSize = BINARY_HEADER_SIZE;
+        if constexpr (std::endian::native != std::endian::little)
+        {
+            version = ((version & 0xFF) << 24) | ((version & 0xFF00) << 8) | ((version >> 8) & 0xFF00) | (version >> 24);
+            headerSize = ((headerSize & 0xFF) << 24) | ((headerSize & 0xFF00) << 8) | ((headerSize >> 8) & 0xFF00) | (headerSize >> 24);
+        }
+        memcpy(header, SCENARIO_MAGIC, sizeof(SCENARIO_MAGIC));
+        memcpy(header + 8, &version, 4);
+        memcpy(header + 12, &headerSize, 4);
+        storeLE64(header + 16, scenarioCount);
+        storeLE64(header + 24, rowCount);
+        storeLE64(header + 32, entryCount);
+        storeLE64(header + 40, checksum);
+
+        if (fseek(outputFile, 0, SEEK_SET) != 0 || fwrite(header, 1, BINARY_HEADER_SIZE, outputFile) != BINARY_HEADER_SIZE)
+        {
+            isFailed = true;
+        }
+        if (fclose(outputFile) != 0)
+        {
+            isFailed = true;
+        }
+    }
+    if (isFailed)
+    {
+        std::cout << "Cannot Write Scenario File" << std::endl;
+        return false;
+    }
+
+    std::cerr << std::fixed << std::setprecision(3) << "Scenarios: " << scenarioCount << ", Branches: " << branch.size() << ", Nonzeros: " << entryCount
+        << ", Pattern: " << patternTime << " ms, Fill: " << fillTime << " ms (" << (scenarioCount > 0 ? fillTime * 1000 / scenarioCount : 0) << " us/Scenario), Write: " << writeTime << " ms" << std::endl;
+
+    return true;
+}
+
+#endif // Y_MATRIX_SCENARIOS_HPP
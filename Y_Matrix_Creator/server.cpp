@@ -0,0 +1,865 @@
+﻿#include "server.hpp"
+
+#ifdef __linux__
+#include<iostream>
+#include<chrono>
+#include<cerrno>
+#include<sys/socket.h>
+#include<sys/un.h>
+#include<sys/epoll.h>
+#include<sys/eventfd.h>
+#include<signal.h>
+#include<fcntl.h>
+#include<unistd.h>
+
+#include "binary_format.hpp"
+
+// 종료 signal을 받았을 때 event loop를 깨우는 eventfd
+int serverWakeFd = -1;
+
+/* stopServer() 함수
+*
+* 기능: 종료 signal(SIGINT, SIGTERM)을 받은 경우, eventfd에 값을 써서 모든 event loop를 깨운다.
+* 입력값: signalNumber
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void stopServer(int signalNumber)
+{
+    uint64_t value = 1;
+    (void)signalNumber;
+    (void)!write(serverWakeFd, &value, sizeof(value));
+
+    return;
+}
+
+/* checkBranchPayload() 함수
+*
+* 기능: 선로 추가/제거 요청의 payload를 확인한다. 길이가 40 Byte의 배수가 아니거나, R, L, C 중 유한하지 않은 값이 있거나,
+*       R과 L이 모두 0인(어드미턴스가 무한대인) 선로가 있는 경우 요청 전체를 거부한다.
+* 입력값: payload, length(payload의 길이)
+* 출력값: 응답의 status(문제가 없는 경우 SERVER_OK)
+* 최종 수정일: 2026/10/17
+*/
+uint32_t checkBranchPayload(const unsigned char* payload, unsigned long long int length)
+{
+    if (length == 0 || length % BINARY_BRANCH_SIZE != 0)
+    {
+        return SERVER_INVALID_LENGTH;
+    }
+    for (unsigned long long int i = 0; i < length; i += BINARY_BRANCH_SIZE)
+    {
+        double R = std::bit_cast<double>(loadLE64(payload + i + 16));
+        double L = std::bit_cast<double>(loadLE64(payload + i + 24));
+        double C = std::bit_cast<double>(loadLE64(payload + i + 32));
+        if (!std::isfinite(R) || !std::isfinite(L) || !std::isfinite(C) || (R == 0 && L == 0))
+        {
+            return SERVER_INVALID_BRANCH;
+        }
+    }
+
+    return SERVER_OK;
+}
+
+/* Matrix_Server의 생성자
+*
+* 기능: 주어진 선로와 소자로 원본 Y-Matrix를 구성하고, 첫 번째 snapshot(version 0)을 만든다.
+* 최종 수정일: 2026/10/17
+*/
+Matrix_Server::Matrix_Server(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device) : branchCounter(branch)
+{
+    yMatrix.addBranches(branch);
+    yMatrix.addDevices(device);
+    publish(0);
+    isWriterStopping = false;
+    listenFd = -1;
+    reserveFd = -1;
+    requestCount = 0;
+    connectionCount = 0;
+    droppedCount = 0;
+
+    return;
+}
+
+/* Matrix_Server의 소멸자
+*
+* 기능: 대기 중인 socket과 예비 fd를 닫는다.
+* 최종 수정일: 2026/10/17
+*/
+Matrix_Server::~Matrix_Server()
+{
+    if (listenFd != -1)
+    {
+        close(listenFd);
+    }
+    if (reserveFd != -1)
+    {
+        close(reserveFd);
+    }
+
+    return;
+}
+
+/* Matrix_Server::publish() 함수
+*
+* 기능: 원본 Y-Matrix를 CSR 형태로 변환하여 새로운 snapshot으로 바꾸어 끼운다. 이전 snapshot은 마지막으로 읽던 요청이 끝날 때 해제된다.
+* 입력값: version(새로운 snapshot의 version)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Matrix_Server::publish(unsigned long long int version)
+{
+    std::shared_ptr<Server_Snapshot> newSnapshot = std::make_shared<Server_Snapshot>();
+    newSnapshot->matrix = yMatrix.freeze();
+    newSnapshot->version = version;
+    snapshot.store(std::move(newSnapshot));
+
+    return;
+}
+
+/* Matrix_Server::writerLoop() 함수
+*
+* 기능: 쓰기 thread. 쌓인 선로 추가/제거 요청을 받은 순서대로 원본 Y-Matrix에 모두 적용한 뒤, 한 번만 새로운 snapshot을 만든다.
+*       제거 요청은 Branch_Counter로 모든 선로가 현재 계통에 있는지 확인하며, 없는 선로가 있으면 요청 전체를 적용하지 않는다.
+*       그 뒤 각 요청을 보낸 연결의 event loop에 결과(새로운 version)를 알린다. 종료를 요청받고 쌓인 요청이 없으면 끝난다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Matrix_Server::writerLoop()
+{
+    std::vector<Server_Write> pending;
+    std::vector<uint32_t> status;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(writeMutex);
+            writeSignal.wait(lock, [&]() { return isWriterStopping || !writeQueue.empty(); });
+            if (writeQueue.empty())
+            {
+                break;
+            }
+            pending.swap(writeQueue);
+        }
+
+        bool isChanged = false;
+        status.assign(pending.size(), SERVER_OK);
+        for (unsigned long long int k = 0; k < pending.size(); k++)
+        {
+            const Server_Write& request = pending[k];
+            const unsigned char* payload = request.payload.data();
+            std::vector<Branch_Val> change(request.payload.size() / BINARY_BRANCH_SIZE);
+            for (unsigned long long int i = 0; i < change.size(); i++)
+            {
+                const unsigned char* record = payload + i * BINARY_BRANCH_SIZE;
+                change[i].node1 = loadLE64(record);
+                change[i].node2 = loadLE64(record + 8);
+                change[i].R = std::bit_cast<double>(loadLE64(record + 16));
+                change[i].L = std::bit_cast<double>(loadLE64(record + 24));
+                change[i].C = std::bit_cast<double>(loadLE64(record + 32));
+            }
+
+            // 현재 계통의 선로 수를 바꾼다. 제거할 선로가 없는 경우, 앞에서 뺀 선로를 되돌리고 요청 전체를 거부한다.
+            unsigned long long int appliedCount = 0;
+            for (; appliedCount < change.size(); appliedCount++)
+            {
+                if (request.isAdd)
+                {
+                    branchCounter.addBranch(change[appliedCount]);
+                }else if (!branchCounter.removeBranch(change[appliedCount]))
+                {
+                    break;
+                }
+            }
+            if (appliedCount < change.size())
+            {
+                for (unsigned long long int i = 0; i < appliedCount; i++)
+                {
+                    branchCounter.addBranch(change[i]);
+                }
+                status[k] = SERVER_BRANCH_NOT_FOUND;
+                continue;
+            }
+
+            for (const Branch_Val& branchVal : change)
+            {
+                if (request.isAdd)
+                {
+                    yMatrix.addMatrixPackage(branchVal.node1, branchVal.node2, branchVal.R, branchVal.L, branchVal.C);
+                }else{
+                    yMatrix.subtractMatrixPackage(branchVal.node1, branchVal.node2, branchVal.R, branchVal.L, branchVal.C);
+                }
+            }
+            isChanged = true;
+        }
+
+        // 적용한 요청이 있는 경우에만 새로운 snapshot을 만든다.
+        unsigned long long int version = snapshot.load()->version;
+        if (isChanged)
+        {
+            version++;
+            publish(version);
+        }
+
+        // 각 요청을 처리하는 event loop에 알린다.
+        for (unsigned long long int k = 0; k < pending.size(); k++)
+        {
+            const Server_Write& request = pending[k];
+            Server_Loop* loop = request.connection->loop;
+            {
+                std::lock_guard<std::mutex> lock(loop->completedMutex);
+                loop->completed.push_back({ request.connection, status[k], version });
+            }
+            uint64_t value = 1;
+            (void)!write(loop->wakeFd, &value, sizeof(value));
+        }
+        pending.clear();
+    }
+
+    return;
+}
+
+/* Matrix_Server::handleRequest() 함수
+*
+* 기능: 읽기 요청 하나를 처리하여, 응답의 payload를 response에 저장한다. 읽기 요청은 처음 읽은 snapshot만을 사용한다.
+*       (선로 추가/제거 요청은 processInput()에서 쓰기 thread로 넘긴다.)
+* 입력값: opcode, payload, length(payload의 길이), response
+* 출력값: 응답의 status
+* 최종 수정일: 2026/10/17
+*/
+uint32_t Matrix_Server::handleRequest(uint32_t opcode, const unsigned char* payload, unsigned long long int length, std::vector<unsigned char>& response)
+{
+    // 응답에 64bit 값을 이어 붙인다.
+    auto appendValue = [&response](uint64_t value)
+    {
+        response.resize(response.size() + 8);
+        storeLE64(response.data() + response.size() - 8, value);
+    };
+
+    std::shared_ptr<const Server_Snapshot> current = snapshot.load();
+    const Y_Matrix_CSR& matrixCSR = current->matrix;
+
+    if (opcode == SERVER_GET)
+    {
+        if (length == 0 || length % 16 != 0)
+        {
+            return SERVER_INVALID_LENGTH;
+        }
+        for (unsigned long long int i = 0; i < length; i += 16)
+        {
+            std::complex<long double> value = matrixCSR.getMatrix(loadLE64(payload + i), loadLE64(payload + i + 8));
+            appendValue(std::bit_cast<uint64_t>((double)value.real()));
+            appendValue(std::bit_cast<uint64_t>((double)value.imag()));
+        }
+    }else if (opcode == SERVER_ROW)
+    {
+        if (length != 8)
+        {
+            return SERVER_INVALID_LENGTH;
+        }
+        long long int row = matrixCSR.findRow(loadLE64(payload));
+        if (row != -1)
+        {
+            if ((unsigned long long int)(matrixCSR.rowPtr[row + 1] - matrixCSR.rowPtr[row]) * 24 > SERVER_MAX_RESPONSE)
+            {
+                return SERVER_TOO_LARGE;
+            }
+            for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+            {
+                appendValue(matrixCSR.nodeNum[matrixCSR.colIdx[cursor]]);
+                appendValue(std::bit_cast<uint64_t>((double)matrixCSR.G[cursor]));
+                appendValue(std::bit_cast<uint64_t>((double)matrixCSR.jB[cursor]));
+            }
+        }
+    }else if (opcode == SERVER_EXPORT)
+    {
+        if (length != 0)
+        {
+            return SERVER_INVALID_LENGTH;
+        }
+        if (matrixCSR.colIdx.size() * 32 > SERVER_MAX_RESPONSE)
+        {
+            return SERVER_TOO_LARGE;
+        }
+        response.reserve(response.size() + matrixCSR.colIdx.size() * 32);
+        for (unsigned long long int row = 0; row < matrixCSR.nodeNum.size(); row++)
+        {
+            for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+            {
+                appendValue(matrixCSR.nodeNum[row]);
+                appendValue(matrixCSR.nodeNum[matrixCSR.colIdx[cursor]]);
+                appendValue(std::bit_cast<uint64_t>((double)matrixCSR.G[cursor]));
+                appendValue(std::bit_cast<uint64_t>((double)matrixCSR.jB[cursor]));
+            }
+        }
+    }else if (opcode == SERVER_INFO)
+    {
+        if (length != 0)
+        {
+            return SERVER_INVALID_LENGTH;
+        }
+        appendValue(current->version);
+        appendValue(matrixCSR.nodeNum.size());
+        appendValue(matrixCSR.colIdx.size());
+    }else{
+        return SERVER_UNKNOWN_OPCODE;
+    }
+
+    return SERVER_OK;
+}
+
+/* appendResponse() 함수
+*
+* 기능: 응답의 header(status, payload 길이)와 payload를 output 뒤에 이어 붙인다.
+* 입력값: output, status, payload, length(payload의 길이, SERVER_MAX_RESPONSE 이하)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void appendResponse(std::vector<unsigned char>& output, uint32_t status, const unsigned char* payload, unsigned long long int length)
+{
+    unsigned char header[SERVER_HEADER_SIZE];
+    uint32_t payloadLength = (uint32_t)length;
+
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        status = ((status & 0xFF) << 24) | ((status & 0xFF00) << 8) | ((status >> 8) & 0xFF00) | (status >> 24);
+        payloadLength = ((payloadLength & 0xFF) << 24) | ((payloadLength & 0xFF00) << 8) | ((payloadLength >> 8) & 0xFF00) | (payloadLength >> 24);
+    }
+    memcpy(header, &status, 4);
+    memcpy(header + 4, &payloadLength, 4);
+    output.insert(output.end(), header, header + SERVER_HEADER_SIZE);
+    output.insert(output.end(), payload, payload + length);
+
+    return;
+}
+
+/* Matrix_Server::receiveInput() 함수
+*
+* 기능: socket에서 받을 수 있는 내용을 모두 받아 input 뒤에 이어 붙인다.
+* 입력값: connection
+* 출력값: 연결이 유지되는 경우 참을, client가 연결을 끊은 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool Matrix_Server::receiveInput(Server_Connection& connection)
+{
+    unsigned char chunk[65536];
+
+    while (true)
+    {
+        ssize_t length = recv(connection.socketFd, chunk, sizeof(chunk), 0);
+        if (length > 0)
+        {
+            connection.input.insert(connection.input.end(), chunk, chunk + length);
+        }else if (length == -1 && errno == EINTR)
+        {
+            continue;
+        }else{
+            return length == -1 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+    }
+}
+
+/* Matrix_Server::processInput() 함수
+*
+* 기능: input에서 완성된 요청을 차례대로 처리하여, 응답(header와 payload)을 output 뒤에 이어 붙인다.
+*       선로 추가/제거 요청은 확인한 뒤 쓰기 thread로 넘기고, 적용될 때까지(isWaitingWrite) 남은 요청을 처리하지 않는다.
+*       보내지 못한 응답이 SERVER_MAX_PENDING보다 많아진 경우, 남은 요청은 응답을 보낸 뒤 처리한다.
+* 입력값: connection
+* 출력값: 요청의 길이가 SERVER_MAX_REQUEST를 넘는 경우 거짓을, 그렇지 않은 경우 참을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool Matrix_Server::processInput(Server_Connection& connection)
+{
+    unsigned long long int cursor = 0;
+    bool isValid = true;
+    std::vector<unsigned char> response;
+
+    while (!connection.isWaitingWrite && connection.input.size() - cursor >= SERVER_HEADER_SIZE && connection.output.size() - connection.outputSent <= SERVER_MAX_PENDING)
+    {
+        // opcode와 payload 길이를 읽는다.
+        uint32_t header[2];
+        memcpy(header, connection.input.data() + cursor, SERVER_HEADER_SIZE);
+        if constexpr (std::endian::native != std::endian::little)
+        {
+            for (uint32_t& value : header)
+            {
+                value = ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) | ((value >> 8) & 0xFF00) | (value >> 24);
+            }
+        }
+        unsigned long long int requestLength = header[1];
+        if (requestLength > SERVER_MAX_REQUEST)
+        {
+            isValid = false;
+            break;
+        }
+        if (connection.input.size() - cursor - SERVER_HEADER_SIZE < requestLength)
+        {
+            break;
+        }
+        const unsigned char* payload = connection.input.data() + cursor + SERVER_HEADER_SIZE;
+        cursor += SERVER_HEADER_SIZE + requestLength;
+        requestCount.fetch_add(1, std::memory_order_relaxed);
+        STATS_ADD(STAT_SERVE_REQUEST, 1);
+
+        // 선로 추가/제거 요청은 쓰기 thread로 넘긴다. (응답은 적용이 끝난 뒤 event loop에서 붙인다.)
+        if (header[0] == SERVER_ADD || header[0] == SERVER_REMOVE)
+        {
+            uint32_t status = checkBranchPayload(payload, requestLength);
+            if (status != SERVER_OK)
+            {
+                appendResponse(connection.output, status, NULL, 0);
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> lock(writeMutex);
+                writeQueue.push_back({ &connection, std::vector<unsigned char>(payload, payload + requestLength), header[0] == SERVER_ADD });
+            }
+            writeSignal.notify_one();
+            connection.isWaitingWrite = true;
+            break;
+        }
+
+        // 요청을 처리하고, 응답의 status와 payload 길이를 header로 한다.
+        response.clear();
+        uint32_t status = handleRequest(header[0], payload, requestLength, response);
+        if (response.size() > SERVER_MAX_RESPONSE)
+        {
+            status = SERVER_TOO_LARGE;
+            response.clear();
+        }
+        appendResponse(connection.output, status, response.data(), response.size());
+    }
+    connection.input.erase(connection.input.begin(), connection.input.begin() + cursor);
+
+    return isValid;
+}
+
+/* Matrix_Server::writeOutput() 함수
+*
+* 기능: 보내지 못한 응답을 보낼 수 있는 만큼 보낸다. 모두 보낸 뒤 처리하지 않은 요청이 남아 있는 경우, 이어서 처리하여 보낸다.
+*       다 보내지 못한 경우 isWaitingOutput을 참으로 하여, 보낼 수 있을 때까지 요청을 더 읽지 않는다.
+*       (client가 응답을 읽지 않을 때 memory가 계속 늘어나지 않도록 한다.)
+* 입력값: connection
+* 출력값: 연결을 유지하는 경우 참을, 연결이 끊겼거나 요청이 잘못된 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool Matrix_Server::writeOutput(Server_Connection& connection)
+{
+    while (connection.outputSent < connection.output.size())
+    {
+        ssize_t length = send(connection.socketFd, connection.output.data() + connection.outputSent, connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+        if (length > 0)
+        {
+            connection.outputSent += length;
+
+            // 모두 보낸 경우, 남아 있는 요청을 처리한다.
+            if (connection.outputSent == connection.output.size())
+            {
+                connection.output.clear();
+                connection.outputSent = 0;
+                if (!processInput(connection))
+                {
+                    return false;
+                }
+            }
+        }else if (length == -1 && errno == EINTR)
+        {
+            continue;
+        }else if (length == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            // 보낼 수 있을 때까지 기다린다.
+            connection.isWaitingOutput = true;
+            return true;
+        }else{
+            return false;
+        }
+    }
+    connection.isWaitingOutput = false;
+
+    return true;
+}
+
+/* Matrix_Server::updateEvents() 함수
+*
+* 기능: 연결의 상태에 맞게 epoll에 등록한 event를 바꾼다. 응답을 보내는 중이면 EPOLLOUT만, 쓰기 요청의 적용이나 client의 종료로
+*       더 읽을 요청이 없으면 등록을 해제하고(level-triggered에서 같은 event가 반복되지 않도록 한다.), 그 외에는 요청을 기다린다.
+* 입력값: connection
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Matrix_Server::updateEvents(Server_Connection& connection)
+{
+    uint32_t events = connection.isWaitingOutput ? EPOLLOUT : (connection.isWaitingWrite || connection.isInputClosed) ? 0 : EPOLLIN | EPOLLRDHUP;
+    epoll_event event;
+
+    if (events == connection.registeredEvents)
+    {
+        return;
+    }
+    event.events = events;
+    event.data.ptr = &connection;
+    if (events == 0)
+    {
+        epoll_ctl(connection.loop->epollFd, EPOLL_CTL_DEL, connection.socketFd, &event);
+    }else{
+        epoll_ctl(connection.loop->epollFd, connection.registeredEvents == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, connection.socketFd, &event);
+    }
+    connection.registeredEvents = events;
+
+    return;
+}
+
+/* Matrix_Server::acceptConnections() 함수
+*
+* 기능: 받을 수 있는 연결을 모두 받아 event loop에 등록한다.
+*       process의 fd가 부족한 경우(EMFILE, ENFILE) 예비 fd를 잠시 닫고 연결을 받아 바로 닫는다.
+*       (받지 않으면 level-triggered인 대기 socket의 event가 계속 반복된다.)
+* 입력값: loop(연결을 처리할 event loop)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Matrix_Server::acceptConnections(Server_Loop& loop)
+{
+    std::vector<std::unique_ptr<Server_Connection>>& connection = loop.connection;
+
+    while (true)
+    {
+        int socketFd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (socketFd == -1)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            if (errno == EMFILE || errno == ENFILE)
+            {
+                // 예비 fd는 여러 event loop가 함께 사용하므로, 잠근 뒤에 확인한다.
+                bool isDropped = false;
+                {
+                    std::lock_guard<std::mutex> lock(reserveMutex);
+                    if (reserveFd != -1)
+                    {
+                        close(reserveFd);
+                        socketFd = accept4(listenFd, NULL, NULL, SOCK_CLOEXEC);
+                        if (socketFd != -1)
+                        {
+                            close(socketFd);
+                            droppedCount.fetch_add(1, std::memory_order_relaxed);
+                            isDropped = true;
+                        }
+                        reserveFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+                    }
+                }
+                if (isDropped)
+                {
+                    continue;
+                }
+            }
+            return;
+        }
+
+        connection.push_back(std::make_unique<Server_Connection>());
+        Server_Connection* newConnection = connection.back().get();
+        newConnection->socketFd = socketFd;
+        newConnection->slot = connection.size() - 1;
+        newConnection->loop = &loop;
+        newConnection->outputSent = 0;
+        newConnection->registeredEvents = 0;
+        newConnection->isWaitingOutput = false;
+        newConnection->isWaitingWrite = false;
+        newConnection->isInputClosed = false;
+        updateEvents(*newConnection);
+        connectionCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/* Matrix_Server::eventLoop() 함수
+*
+* 기능: thread 하나의 epoll event loop. 새로운 연결을 받아(EPOLLEXCLUSIVE로 한 thread만 깨어난다.) 해당 thread에서 요청을 처리하며,
+*       쓰기 thread가 선로 추가/제거를 적용하면 해당 연결에 응답을 붙이고 남은 요청을 이어서 처리한다. 종료용 eventfd에 값이 써지면 끝난다.
+* 입력값: loop(이 thread의 epoll과 적용을 마친 쓰기 요청)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Matrix_Server::eventLoop(Server_Loop& loop)
+{
+    std::vector<std::unique_ptr<Server_Connection>>& connection = loop.connection; // 이 thread가 처리하는 연결
+    std::vector<Server_Result> completed;
+    epoll_event event, readyEvent[SERVER_MAX_EVENT];
+    bool isRunning = true;
+
+    // 대기 중인 socket, 종료용 eventfd, 쓰기 완료용 eventfd를 등록한다. (data.ptr가 각 fd 변수를 가리키는지로 구분한다.)
+    event.events = EPOLLIN | EPOLLEXCLUSIVE;
+    event.data.ptr = &listenFd;
+    epoll_ctl(loop.epollFd, EPOLL_CTL_ADD, listenFd, &event);
+    event.events = EPOLLIN;
+    event.data.ptr = &serverWakeFd;
+    epoll_ctl(loop.epollFd, EPOLL_CTL_ADD, serverWakeFd, &event);
+    event.events = EPOLLIN;
+    event.data.ptr = &loop.wakeFd;
+    epoll_ctl(loop.epollFd, EPOLL_CTL_ADD, loop.wakeFd, &event);
+
+    // 연결을 닫고 목록에서 제거한다. (마지막 연결을 제거된 위치로 옮긴다.)
+    // 쓰기 요청의 적용을 기다리는 연결은 쓰기 thread가 가리키고 있으므로, socket만 닫고 적용이 끝난 뒤 제거한다.
+    auto closeConnection = [&connection](Server_Connection* closing)
+    {
+        if (closing->socketFd != -1)
+        {
+            close(closing->socketFd);
+            closing->socketFd = -1;
+        }
+        if (closing->isWaitingWrite)
+        {
+            return;
+        }
+
+        unsigned long long int slot = closing->slot;
+        if (slot != connection.size() - 1)
+        {
+            connection[slot] = std::move(connection.back());
+            connection[slot]->slot = slot;
+        }
+        connection.pop_back();
+    };
+
+    // 응답을 보내고 event를 다시 등록한다. 더 처리할 수 없는 연결은 닫는다.
+    auto serviceConnection = [&](Server_Connection* current, bool isValid)
+    {
+        if (!isValid || !writeOutput(*current) || (current->isInputClosed && !current->isWaitingOutput && !current->isWaitingWrite))
+        {
+            closeConnection(current);
+            return;
+        }
+        updateEvents(*current);
+    };
+
+    while (isRunning)
+    {
+        int readyCount = epoll_wait(loop.epollFd, readyEvent, SERVER_MAX_EVENT, -1);
+        if (readyCount == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+
+        for (int i = 0; i < readyCount; i++)
+        {
+            if (readyEvent[i].data.ptr == &serverWakeFd)
+            {
+                // 종료 signal을 받은 경우(eventfd의 값은 읽지 않아, 모든 thread가 깨어난다.)
+                isRunning = false;
+            }else if (readyEvent[i].data.ptr == &listenFd)
+            {
+                acceptConnections(loop);
+            }else if (readyEvent[i].data.ptr == &loop.wakeFd)
+            {
+                // 적용을 마친 쓰기 요청에 응답을 붙이고, 남은 요청을 이어서 처리한다.
+                uint64_t value;
+                (void)!read(loop.wakeFd, &value, sizeof(value));
+                {
+                    std::lock_guard<std::mutex> lock(loop.completedMutex);
+                    completed.swap(loop.completed);
+                }
+                for (const Server_Result& result : completed)
+                {
+                    Server_Connection* current = result.connection;
+                    current->isWaitingWrite = false;
+                    if (current->socketFd == -1)
+                    {
+                        closeConnection(current);
+                        continue;
+                    }
+
+                    if (result.status == SERVER_OK)
+                    {
+                        unsigned char payload[8];
+                        storeLE64(payload, result.version);
+                        appendResponse(current->output, SERVER_OK, payload, sizeof(payload));
+                    }else{
+                        appendResponse(current->output, result.status, NULL, 0);
+                    }
+                    serviceConnection(current, processInput(*current));
+                }
+                completed.clear();
+            }else{
+                Server_Connection* current = (Server_Connection*)readyEvent[i].data.ptr;
+
+                if (readyEvent[i].events & (EPOLLERR | EPOLLHUP))
+                {
+                    closeConnection(current);
+                    continue;
+                }
+
+                // 요청을 받아 처리한 뒤, 응답을 보낸다. (client가 연결을 끊은 경우, 받은 요청의 응답을 보낸 뒤 닫는다.)
+                bool isValid = true;
+                if (!current->isWaitingOutput)
+                {
+                    current->isInputClosed = !receiveInput(*current);
+                    isValid = processInput(*current);
+                }
+                serviceConnection(current, isValid);
+            }
+        }
+    }
+
+    // 쓰기 요청의 적용을 기다리는 연결도 있으므로, socket만 닫고 구조체는 쓰기 thread가 끝난 뒤 run()에서 해제한다.
+    for (unsigned long long int i = 0; i < connection.size(); i++)
+    {
+        if (connection[i]->socketFd != -1)
+        {
+            close(connection[i]->socketFd);
+            connection[i]->socketFd = -1;
+        }
+    }
+
+    return;
+}
+
+/* Matrix_Server::listen() 함수
+*
+* 기능: 주어진 위치에 Unix domain socket을 만들어 연결을 기다린다. 같은 위치에 이전 socket 파일이 남아 있는 경우, 지우고 다시 만든다.
+* 입력값: socketPath
+* 출력값: 성공한 경우 참을, 실패한 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool Matrix_Server::listen(const std::string& socketPath)
+{
+    sockaddr_un address;
+
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        return false;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    reserveFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    if (listenFd == -1 || reserveFd == -1)
+    {
+        return false;
+    }
+    unlink(socketPath.c_str());
+    if (bind(listenFd, (const sockaddr*)&address, sizeof(address)) != 0 || ::listen(listenFd, SOMAXCONN) != 0)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/* Matrix_Server::run() 함수
+*
+* 기능: 쓰기 thread와 주어진 수의 thread에서 event loop를 실행하고, 종료 signal을 받아 모든 thread가 끝날 때까지 기다린다.
+*       event loop가 모두 끝난 뒤 쓰기 thread를 종료하며, 그 뒤에 연결 구조체를 해제한다.
+* 입력값: threadCount
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Matrix_Server::run(int threadCount)
+{
+    std::vector<std::unique_ptr<Server_Loop>> loop;
+    std::vector<std::thread> worker;
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        loop.push_back(std::make_unique<Server_Loop>());
+        loop[i]->epollFd = epoll_create1(EPOLL_CLOEXEC);
+        loop[i]->wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    }
+    isWriterStopping = false;
+    std::thread writer(&Matrix_Server::writerLoop, this);
+    for (int i = 1; i < threadCount; i++)
+    {
+        worker.emplace_back(&Matrix_Server::eventLoop, this, std::ref(*loop[i]));
+    }
+    eventLoop(*loop[0]);
+    for (std::thread& thread : worker)
+    {
+        thread.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        isWriterStopping = true;
+    }
+    writeSignal.notify_one();
+    writer.join();
+    for (int i = 0; i < threadCount; i++)
+    {
+        close(loop[i]->epollFd);
+        close(loop[i]->wakeFd);
+    }
+
+    return;
+}
+
+/* Matrix_Server::requests() 함수
+*
+* 기능: 지금까지 처리한 요청의 수를 출력한다.
+* 입력값 없음
+* 출력값: 처리한 요청의 수
+* 최종 수정일: 2026/10/17
+*/
+unsigned long long int Matrix_Server::requests() const
+{
+    return requestCount.load();
+}
+
+/* Matrix_Server::connections() 함수
+*
+* 기능: 지금까지 받은 연결의 수를 출력한다.
+* 입력값 없음
+* 출력값: 받은 연결의 수
+* 최종 수정일: 2026/10/17
+*/
+unsigned long long int Matrix_Server::connections() const
+{
+    return connectionCount.load();
+}
+
+/* Matrix_Server::dropped() 함수
+*
+* 기능: fd가 부족하여 받은 뒤 바로 닫은 연결의 수를 출력한다.
+* 입력값 없음
+* 출력값: 닫은 연결의 수
+* 최종 수정일: 2026/10/17
+*/
+unsigned long long int Matrix_Server::dropped() const
+{
+    return droppedCount.load();
+}
+
+/* serveMatrix() 함수
+*
+* 기능: 선로, 소자 정보로 Matrix_Server를 만들어, 주어진 위치의 Unix domain socket으로 요청을 받는다. SIGINT, SIGTERM을 받으면 종료하고 socket 파일을 지운다.
+* 입력값: branch, device, socketPath, threadCount
+* 출력값: 정상적으로 종료한 경우 참을, socket을 만들 수 없는 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool serveMatrix(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, const std::string& socketPath, int threadCount)
+{
+    Matrix_Server server(branch, device);
+    serverWakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (serverWakeFd == -1 || !server.listen(socketPath))
+    {
+        return false;
+    }
+    signal(SIGINT, stopServer);
+    signal(SIGTERM, stopServer);
+
+    std::cerr << "Listening: " << socketPath << ", Threads: " << threadCount << std::endl;
+    server.run(threadCount);
+
+    unlink(socketPath.c_str());
+    close(serverWakeFd);
+    std::cerr << "Connections: " << server.connections() << ", Requests: " << server.requests() << ", Dropped: " << server.dropped() << std::endl;
+
+    return true;
+}
+#endif
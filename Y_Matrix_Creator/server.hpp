@@ -0,0 +1,194 @@
+﻿/* server.hpp
+*
+* Linux에서 계통을 memory에 두고, Unix domain socket과 epoll event loop로 여러 client의 요청에 응답한다. (--serve 옵션)
+*/
+#ifndef Y_MATRIX_SERVER_HPP
+#define Y_MATRIX_SERVER_HPP
+
+#include<vector>
+#include<string>
+#include<memory>
+#include<atomic>
+#include<mutex>
+#include<condition_variable>
+#include<thread>
+
+#include "stream.hpp"
+
+#ifdef __linux__
+/* Server 통신 형식
+*
+* 모든 값은 little-endian이며, 실수는 IEEE 754 64bit(double)로 주고받는다.
+* 요청: opcode(4 Byte), payload 길이(4 Byte), payload
+* 응답: status(4 Byte), payload 길이(4 Byte), payload
+* SERVER_GET: (node1, node2)(16 Byte씩) → (G, jB)(16 Byte씩), 한 번에 여러 값을 읽는다.
+* SERVER_ROW: node(8 Byte) → 해당 행의 (node, G, jB)(24 Byte씩), 행이 없는 경우 빈 payload
+* SERVER_ADD, SERVER_REMOVE: (node1, node2, R, L, C)(40 Byte씩) → 요청이 반영된 snapshot의 version(8 Byte)
+*   (R, L, C 중 유한하지 않은 값이 있거나 R과 L이 모두 0인 선로가 있는 경우 SERVER_INVALID_BRANCH, 요청 전체를 반영하지 않는다.)
+*   (SERVER_REMOVE에서 현재 계통에 없는 선로가 있는 경우 SERVER_BRANCH_NOT_FOUND와 빈 payload, 요청 전체를 반영하지 않는다.)
+*   (쓰기 thread가 그동안 쌓인 요청을 한 번에 반영하므로, 여러 요청이 같은 version을 받을 수 있다.)
+* SERVER_EXPORT: 없음 → 모든 0이 아닌 값의 (node1, node2, G, jB)(32 Byte씩)
+* SERVER_INFO: 없음 → version, 행의 수, 0이 아닌 값의 수(각 8 Byte)
+* 응답의 payload가 4 GB 이상이 되는 경우 SERVER_TOO_LARGE와 빈 payload로 응답한다.
+*/
+const uint32_t SERVER_GET = 1;
+const uint32_t SERVER_ROW = 2;
+const uint32_t SERVER_ADD = 3;
+const uint32_t SERVER_REMOVE = 4;
+const uint32_t SERVER_EXPORT = 5;
+const uint32_t SERVER_INFO = 6;
+
+const uint32_t SERVER_OK = 0;
+const uint32_t SERVER_UNKNOWN_OPCODE = 1;
+const uint32_t SERVER_INVALID_LENGTH = 2;
+const uint32_t SERVER_INVALID_BRANCH = 3;
+const uint32_t SERVER_TOO_LARGE = 4;
+const uint32_t SERVER_BRANCH_NOT_FOUND = 5;
+
+const unsigned long long int SERVER_HEADER_SIZE = 8;
+// 요청 payload의 최대 길이(넘는 경우 연결을 끊는다.)
+const unsigned long long int SERVER_MAX_REQUEST = 1 << 24;
+// 응답 payload의 최대 길이(header의 길이가 4 Byte이므로, 넘는 경우 SERVER_TOO_LARGE로 응답한다.)
+const unsigned long long int SERVER_MAX_RESPONSE = UINT32_MAX;
+// 보내지 못한 응답이 이보다 많은 경우, 다 보낼 때까지 요청을 읽지 않는다.
+const unsigned long long int SERVER_MAX_PENDING = 1 << 22;
+const int SERVER_MAX_EVENT = 256;
+
+/* Server_Snapshot 구조체
+*
+* 기능: 읽기 요청에 사용하는, 변경되지 않는 CSR 형태의 Y-Matrix와 그 version을 저장한다.
+* 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    Y_Matrix_CSR matrix;
+    unsigned long long int version;
+} Server_Snapshot;
+
+struct Server_Loop;
+
+/* Server_Connection 구조체
+*
+* 기능: 연결된 client 하나의 socket과, 다 받지 못한 요청, 다 보내지 못한 응답을 저장한다.
+* 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    int socketFd; // 연결의 socket(쓰기 요청을 기다리는 중에 닫힌 경우 -1)
+    unsigned long long int slot; // 연결 목록에서의 위치
+    Server_Loop* loop; // 연결을 처리하는 event loop
+    std::vector<unsigned char> input, output;
+    unsigned long long int outputSent; // output에서 이미 보낸 길이
+    uint32_t registeredEvents; // epoll에 등록한 event(0인 경우 등록하지 않음)
+    bool isWaitingOutput; // 응답을 다 보낼 때까지 요청을 읽지 않는 중인지 여부
+    bool isWaitingWrite; // 선로 추가/제거 요청이 적용될 때까지 요청을 읽지 않는 중인지 여부
+    bool isInputClosed; // client가 더 이상 요청을 보내지 않는지 여부
+} Server_Connection;
+
+/* Server_Result 구조체
+*
+* 기능: 쓰기 thread가 처리를 마친 선로 추가/제거 요청 하나의 연결과 응답(status, 반영된 snapshot의 version)을 저장한다.
+* 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    Server_Connection* connection;
+    uint32_t status; // SERVER_OK 또는 SERVER_BRANCH_NOT_FOUND
+    unsigned long long int version; // status가 SERVER_OK인 경우에만 사용한다.
+} Server_Result;
+
+/* Server_Loop 구조체
+*
+* 기능: event loop(thread) 하나의 epoll과 처리하는 연결, 쓰기 thread가 적용을 마친 선로 추가/제거 요청(연결과 새로운 snapshot의 version)을 저장한다.
+*       쓰기 thread는 completed에 추가한 뒤 wakeFd에 값을 써서 event loop를 깨운다.
+*       연결 구조체는 쓰기 thread가 가리키고 있을 수 있으므로, 모든 thread가 끝난 뒤 함께 해제한다.
+* 최종 수정일: 2026/10/17
+*/
+struct Server_Loop
+{
+    int epollFd, wakeFd;
+    std::vector<std::unique_ptr<Server_Connection>> connection;
+    std::mutex completedMutex;
+    std::vector<Server_Result> completed;
+};
+
+/* Server_Write 구조체
+*
+* 기능: 쓰기 thread에 전달하는 선로 추가/제거 요청 하나를 저장한다.
+* 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    Server_Connection* connection;
+    std::vector<unsigned char> payload; // (node1, node2, R, L, C)가 40 Byte씩 저장된 요청의 payload
+    bool isAdd;
+} Server_Write;
+
+/* Matrix_Server 클래스
+*
+* 기능: 계통을 한 번 읽어 memory에 두고, Unix domain socket으로 받은 요청(값 읽기, 행 읽기, 선로 추가/제거, 전체 출력)에 응답한다.
+*       각 thread는 epoll event loop로 여러 연결을 처리하며, 읽기 요청은 잠금 없이 현재 snapshot(CSR 형태)을 읽는다.
+*       선로 추가/제거 요청은 하나의 쓰기 thread에 넘기며, 쓰기 thread는 쌓인 요청을 모두 원본 Y_Matrix에 적용한 뒤 새로운 snapshot을
+*       한 번만 만들어 바꾸어 끼운다.(copy-on-write) 따라서 event loop는 snapshot을 만드는 동안에도 다른 연결의 요청을 처리하며,
+*       이전 snapshot을 읽는 중인 요청은 기다리지 않고 끝까지 이전 값을 읽는다.
+*       쓰기 요청을 보낸 연결은 응답 순서를 지키기 위해, 적용이 끝날 때까지 다음 요청을 처리하지 않는다.
+* 최종 수정일: 2026/10/17
+*/
+class Matrix_Server{
+private:
+    // 선로 추가/제거를 적용하는 원본 Y-Matrix와, 현재 계통에 있는 선로의 수(쓰기 thread만 사용한다.)
+    Y_Matrix<long double, long long int> yMatrix;
+    Branch_Counter branchCounter;
+
+    // 읽기 요청에 사용하는 현재 snapshot
+    std::atomic<std::shared_ptr<const Server_Snapshot>> snapshot;
+
+    // 쓰기 thread에 넘긴 요청과, 이를 보호하는 잠금
+    std::mutex writeMutex;
+    std::condition_variable writeSignal;
+    std::vector<Server_Write> writeQueue;
+    bool isWriterStopping;
+
+    // fd가 부족하여 연결을 받을 수 없을 때, 잠시 닫아 연결을 받고 바로 닫는 데 사용하는 예비 fd
+    int listenFd, reserveFd;
+    std::mutex reserveMutex;
+    std::atomic<unsigned long long int> requestCount, connectionCount, droppedCount;
+
+    void publish(unsigned long long int version);
+
+    void writerLoop();
+
+    uint32_t handleRequest(uint32_t opcode, const unsigned char* payload, unsigned long long int length, std::vector<unsigned char>& response);
+
+    bool receiveInput(Server_Connection& connection);
+
+    bool processInput(Server_Connection& connection);
+
+    bool writeOutput(Server_Connection& connection);
+
+    void updateEvents(Server_Connection& connection);
+
+    void acceptConnections(Server_Loop& loop);
+
+    void eventLoop(Server_Loop& loop);
+
+public:
+Matrix_Server(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device);
+~Matrix_Server();
+
+bool listen(const std::string& socketPath);
+
+void run(int threadCount);
+
+unsigned long long int requests() const;
+
+unsigned long long int connections() const;
+
+unsigned long long int dropped() const;
+
+};
+
+bool serveMatrix(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, const std::string& socketPath, int threadCount);
+#endif
+
+#endif // Y_MATRIX_SERVER_HPP
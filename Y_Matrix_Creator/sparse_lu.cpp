@@ -0,0 +1,41 @@
+﻿#include<chrono>
+
+#include "sparse_lu.hpp"
+
+/* factorMatrix() 함수
+*
+* 기능: CSR 형태의 Y-Matrix를 복소수 희소 행렬로 LU 분해한다.
+* 입력값: matrixCSR, matrixLU(분해 결과를 저장할 변수), analyzeTime, factorTime(분석, 분해에 걸린 시간(ms)을 저장할 변수),
+*         errorMessage(실패한 경우, 오류 내용을 저장할 변수)
+* 출력값: 분해 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool factorMatrix(const Y_Matrix_CSR& matrixCSR, Sparse_LU<std::complex<double>>& matrixLU, double& analyzeTime, double& factorTime, std::string& errorMessage)
+{
+    std::vector<std::complex<double>> value(matrixCSR.colIdx.size());
+
+    for (unsigned long long int i = 0; i < value.size(); i++)
+    {
+        value[i] = std::complex<double>((double)matrixCSR.G[i], (double)matrixCSR.jB[i]);
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    if (!matrixLU.analyze(matrixCSR.nodeNum.size(), matrixCSR.rowPtr, matrixCSR.colIdx))
+    {
+        errorMessage = "Invalid Y-Matrix Structure";
+        return false;
+    }
+    auto analyzeEndTime = std::chrono::steady_clock::now();
+    bool isFactored = matrixLU.factor(value);
+    auto factorEndTime = std::chrono::steady_clock::now();
+
+    analyzeTime = std::chrono::duration<double, std::milli>(analyzeEndTime - startTime).count();
+    factorTime = std::chrono::duration<double, std::milli>(factorEndTime - analyzeEndTime).count();
+    if (!isFactored)
+    {
+        // pivoting을 하지 않으므로, 너무 작은 pivot은 특이 행렬(접지되지 않은 섬 계통 등)로 본다.
+        errorMessage = "Singular Y-Matrix - Pivot Too Small at Node " + std::to_string(matrixCSR.nodeNum[matrixLU.failedPivot()]);
+    }
+
+    return isFactored;
+}
@@ -0,0 +1,508 @@
+﻿/* sparse_lu.hpp
+*
+* 희소 행렬 LU 분해(Sparse_LU 클래스)와 Y-Matrix의 분해
+*/
+#ifndef Y_MATRIX_SPARSE_LU_HPP
+#define Y_MATRIX_SPARSE_LU_HPP
+
+#include<vector>
+#include<complex>
+#include<string>
+#include<queue>
+#include<cmath>
+
+#include "y_matrix.hpp"
+
+// LU 분해에서 허용하는 pivot의 최소 크기(해당 행의 분해 전 값 중 가장 큰 크기에 대한 비율)
+// pivoting 없이 대각 성분만을 pivot으로 사용하므로, 이보다 작은 pivot은 특이 행렬이거나 오차가 커서 분해할 수 없는 것으로 본다.
+const double LU_PIVOT_THRESHOLD = 1e-12;
+
+/* subtractProduct() 함수
+*
+* 기능: target -= a * b를 계산한다. 복소수의 경우 NaN, 무한대 처리 없이 실수부와 허수부를 직접 계산한다. (LU 분해의 내부 반복에 사용)
+* 입력값: target, a, b
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+inline void subtractProduct(double& target, double a, double b)
+{
+    target -= a * b;
+
+    return;
+}
+
+inline void subtractProduct(std::complex<double>& target, const std::complex<double>& a, const std::complex<double>& b)
+{
+    target = std::complex<double>(target.real() - (a.real() * b.real() - a.imag() * b.imag()), target.imag() - (a.real() * b.imag() + a.imag() * b.real()));
+
+    return;
+}
+
+/* Sparse_LU 클래스
+*
+* 기능: 구조적으로 대칭인(a_ij가 0이 아니면 a_ji도 0이 아닌) 희소 행렬을 LU 분해하고, 분해 결과로 연립방정식을 푼다.
+*       analyze()에서 최소 차수(Minimum Degree) 순서를 구하고 fill-in을 포함한 L, U의 구조를 미리 계산하므로,
+*       구조가 같고 값만 다른 행렬은 factor()만 다시 호출하여 분해할 수 있다.
+*       대각 성분을 pivot으로 사용하며(pivoting 없음), Y-Matrix나 전력 조류 계산의 Jacobian과 같이 대각 성분이 큰 행렬을 대상으로 한다.
+*       pivot이 해당 행의 가장 큰 값에 비해 LU_PIVOT_THRESHOLD배 이하로 작은 경우 분해하지 않고, 그 행을 failedPivot()으로 알려준다.
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+class Sparse_LU{
+private:
+    // 행렬의 크기
+    long long int matrixSize;
+
+    // 분해 순서(pivotOrder[k]: k번째로 분해하는 원래 행의 위치, pivotPosition[i]: 원래 행 i의 분해 순서)
+    std::vector<long long int> pivotOrder, pivotPosition;
+
+    // 분해 순서로 바꾼 L, U의 구조(행별, 열 위치 오름차순). 각 행에서 diagPtr 앞은 L, diagPtr은 대각 성분, 뒤는 U이다.
+    std::vector<long long int> luRowPtr, luColIdx, diagPtr;
+
+    // 입력 행렬의 각 값이 저장될 L, U에서의 위치
+    std::vector<long long int> valueMap;
+
+    // L, U의 값
+    std::vector<T> luValue;
+
+    // 마지막 factor()에서 pivot이 너무 작았던 원래 행의 위치(없으면 -1)
+    long long int failedRow;
+
+    bool isAnalyzed, isFactored;
+
+public:
+Sparse_LU();
+
+bool analyze(long long int size, const std::vector<long long int>& rowPtr, const std::vector<long long int>& colIdx);
+
+bool factor(const std::vector<T>& value);
+
+void solve(std::vector<T>& rhs) const;
+
+void solve(std::vector<T>& rhs, std::vector<T>& work) const;
+
+long long int size() const;
+
+long long int factorNonzeros() const;
+
+long long int failedPivot() const;
+
+};
+
+/* Sparse_LU의 생성자
+*
+* 특별한 기능 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+Sparse_LU<T>::Sparse_LU()
+{
+    matrixSize = 0;
+    failedRow = -1;
+    isAnalyzed = false;
+    isFactored = false;
+
+    return;
+}
+
+/* Sparse_LU::analyze() 함수
+*
+* 기능: 행렬의 구조만을 보고 분해 순서와 L, U의 구조를 구한다. (Symbolic Analysis)
+*       분해 순서는 남은 node 중 연결된 node가 가장 적은 node부터 소거하는 최소 차수(Minimum Degree) 방식으로 정하며,
+*       node를 소거할 때 연결된 node끼리 새로 연결되는 부분(fill-in)을 L, U의 구조에 포함한다.
+* 입력값: size(행렬의 크기), rowPtr, colIdx(CSR 형태의 행렬 구조)
+* 출력값: 분석 성공 여부(열 위치가 범위를 벗어난 경우 거짓)
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+bool Sparse_LU<T>::analyze(long long int size, const std::vector<long long int>& rowPtr, const std::vector<long long int>& colIdx)
+{
+    isAnalyzed = false;
+    isFactored = false;
+    matrixSize = size;
+
+    // 대각 성분을 제외한 연결 관계를 대칭으로 만든다.
+    std::vector<std::vector<long long int>> adjacency(size);
+    for (long long int row = 0; row < size; row++)
+    {
+        for (long long int cursor = rowPtr[row]; cursor < rowPtr[row + 1]; cursor++)
+        {
+            long long int col = colIdx[cursor];
+            if (col < 0 || col >= size)
+            {
+                return false;
+            }
+            if (col != row)
+            {
+                adjacency[row].push_back(col);
+                adjacency[col].push_back(row);
+            }
+        }
+    }
+    for (long long int i = 0; i < size; i++)
+    {
+        std::sort(adjacency[i].begin(), adjacency[i].end());
+        adjacency[i].erase(std::unique(adjacency[i].begin(), adjacency[i].end()), adjacency[i].end());
+    }
+
+    // 최소 차수 순서로 node를 소거한다. (차수가 같은 경우, 번호가 작은 node부터 소거한다.)
+    // 소거한 node는 연결되어 있던 node의 목록(element)으로 남겨, fill-in을 직접 만들지 않고 연결 관계를 나타낸다. (Quotient Graph)
+    // 각 node의 차수는 정확한 값 대신, element끼리 겹치는 부분만을 빼 계산한 근사값(Approximate Minimum Degree)을 사용한다.
+    // 차수가 줄어든 경우에만 queue에 다시 넣고(queuedMin), 늘어난 경우는 꺼낼 때 늘어난 차수로 다시 넣는다.
+    // queue의 값은 항상 현재 차수 이하이므로, 모든 차수를 바뀔 때마다 넣는 경우와 같은 순서로 꺼내면서 queue의 크기를 줄인다.
+    std::priority_queue<std::pair<long long int, long long int>, std::vector<std::pair<long long int, long long int>>, std::greater<std::pair<long long int, long long int>>> degreeQueue;
+    std::vector<char> isEliminated(size, false), isAbsorbed(size, false);
+    std::vector<std::vector<long long int>> elementOf(size); // 각 node가 속한 element
+    std::vector<std::vector<long long int>> eliminatedColumn(size); // 소거할 때 연결되어 있던 node(element의 구성 node, L의 열 구조)
+    std::vector<long long int> degree(size), queuedMin(size), marker(size, -1), outsideCount(size, -1);
+
+    pivotOrder.clear();
+    pivotOrder.reserve(size);
+    for (long long int i = 0; i < size; i++)
+    {
+        degree[i] = adjacency[i].size();
+        queuedMin[i] = degree[i];
+        degreeQueue.push({ degree[i], i });
+    }
+    while (!degreeQueue.empty())
+    {
+        long long int queuedDegree = degreeQueue.top().first, node = degreeQueue.top().second;
+        long long int remainCount = size - pivotOrder.size() - 1;
+        degreeQueue.pop();
+
+        // 이미 소거했거나, 더 작은 차수로 다시 넣은 경우 무시한다.
+        if (isEliminated[node] || queuedDegree != queuedMin[node])
+        {
+            continue;
+        }
+
+        // 차수가 늘어난 경우, 늘어난 차수로 다시 넣는다.
+        if (queuedDegree != degree[node])
+        {
+            queuedMin[node] = degree[node];
+            degreeQueue.push({ degree[node], node });
+            continue;
+        }
+        isEliminated[node] = true;
+        pivotOrder.push_back(node);
+
+        // 소거한 node와 연결된 node를 모은다. (직접 연결된 node와, 속해 있던 element의 node)
+        std::vector<long long int>& column = eliminatedColumn[node];
+        marker[node] = node;
+        for (long long int neighbor : adjacency[node])
+        {
+            if (marker[neighbor] != node && !isEliminated[neighbor])
+            {
+                marker[neighbor] = node;
+                column.push_back(neighbor);
+            }
+        }
+        for (long long int element : elementOf[node])
+        {
+            if (isAbsorbed[element])
+            {
+                continue;
+            }
+            for (long long int neighbor : eliminatedColumn[element])
+            {
+                if (marker[neighbor] != node && !isEliminated[neighbor])
+                {
+                    marker[neighbor] = node;
+                    column.push_back(neighbor);
+                }
+            }
+            // 해당 element는 새 element에 흡수된다. (구성 node는 L의 구조로 남겨둔다.)
+            isAbsorbed[element] = true;
+        }
+        std::vector<long long int>().swap(adjacency[node]);
+        std::vector<long long int>().swap(elementOf[node]);
+
+        // 다른 element 중 새 element에 속하지 않은 node의 수를 구한다.
+        for (long long int neighbor : column)
+        {
+            for (long long int element : elementOf[neighbor])
+            {
+                if (isAbsorbed[element])
+                {
+                    continue;
+                }
+                if (outsideCount[element] < 0)
+                {
+                    outsideCount[element] = eliminatedColumn[element].size();
+                }
+                outsideCount[element]--;
+            }
+        }
+
+        // 연결된 node의 연결 관계와 차수를 수정한다.
+        for (long long int neighbor : column)
+        {
+            long long int newDegree = column.size() - 1;
+
+            // 흡수된 element를 지우고 새 element를 추가한다.
+            std::vector<long long int>& elementList = elementOf[neighbor];
+            elementList.erase(std::remove_if(elementList.begin(), elementList.end(), [&](long long int e) { return isAbsorbed[e]; }), elementList.end());
+            for (long long int element : elementList)
+            {
+                newDegree += outsideCount[element] < 0 ? eliminatedColumn[element].size() : outsideCount[element];
+            }
+            elementList.push_back(node);
+
+            // 새 element로 연결되는 node와 소거된 node는 직접 연결 목록에서 지운다.
+            std::vector<long long int>& adjacencyList = adjacency[neighbor];
+            adjacencyList.erase(std::remove_if(adjacencyList.begin(), adjacencyList.end(), [&](long long int i) { return marker[i] == node || isEliminated[i]; }), adjacencyList.end());
+            newDegree += adjacencyList.size();
+
+            newDegree = std::min(newDegree, std::min(remainCount, degree[neighbor] + (long long int)column.size() - 1));
+            degree[neighbor] = newDegree;
+            if (newDegree < queuedMin[neighbor])
+            {
+                queuedMin[neighbor] = newDegree;
+                degreeQueue.push({ newDegree, neighbor });
+            }
+        }
+
+        // 다음 소거를 위해 계산한 값을 초기화한다.
+        for (long long int neighbor : column)
+        {
+            for (long long int element : elementOf[neighbor])
+            {
+                outsideCount[element] = -1;
+            }
+        }
+    }
+
+    pivotPosition.assign(size, 0);
+    for (long long int k = 0; k < size; k++)
+    {
+        pivotPosition[pivotOrder[k]] = k;
+    }
+
+    // 분해 순서로 바꾼 L, U의 구조를 만든다. k번째 node의 열 구조가 L의 k번째 열과 U의 k번째 행이 된다.
+    std::vector<long long int> rowLength(size, 1);
+    for (long long int k = 0; k < size; k++)
+    {
+        rowLength[k] += eliminatedColumn[pivotOrder[k]].size();
+        for (long long int neighbor : eliminatedColumn[pivotOrder[k]])
+        {
+            rowLength[pivotPosition[neighbor]]++;
+        }
+    }
+    luRowPtr.assign(size + 1, 0);
+    for (long long int k = 0; k < size; k++)
+    {
+        luRowPtr[k + 1] = luRowPtr[k] + rowLength[k];
+    }
+    luColIdx.resize(luRowPtr[size]);
+    std::vector<long long int> fillCursor(luRowPtr.begin(), luRowPtr.end() - 1);
+    for (long long int k = 0; k < size; k++)
+    {
+        luColIdx[fillCursor[k]++] = k;
+        for (long long int neighbor : eliminatedColumn[pivotOrder[k]])
+        {
+            long long int position = pivotPosition[neighbor];
+            luColIdx[fillCursor[k]++] = position;
+            luColIdx[fillCursor[position]++] = k;
+        }
+    }
+    diagPtr.resize(size);
+    for (long long int k = 0; k < size; k++)
+    {
+        std::sort(luColIdx.begin() + luRowPtr[k], luColIdx.begin() + luRowPtr[k + 1]);
+        diagPtr[k] = std::lower_bound(luColIdx.begin() + luRowPtr[k], luColIdx.begin() + luRowPtr[k + 1], k) - luColIdx.begin();
+    }
+
+    // 입력 행렬의 각 값이 저장될 위치를 구한다.
+    valueMap.resize(rowPtr[size]);
+    for (long long int row = 0; row < size; row++)
+    {
+        long long int position = pivotPosition[row];
+        for (long long int cursor = rowPtr[row]; cursor < rowPtr[row + 1]; cursor++)
+        {
+            valueMap[cursor] = std::lower_bound(luColIdx.begin() + luRowPtr[position], luColIdx.begin() + luRowPtr[position + 1], pivotPosition[colIdx[cursor]]) - luColIdx.begin();
+        }
+    }
+
+    luValue.assign(luColIdx.size(), T(0));
+    isAnalyzed = true;
+
+    return true;
+}
+
+/* Sparse_LU::factor() 함수
+*
+* 기능: analyze()에서 구한 구조를 사용하여, 주어진 값의 행렬을 LU 분해한다. (Numeric Factorization)
+*       분해 순서대로 한 행씩, 앞선 행의 U로 L 부분을 소거한다. (L의 대각 성분은 1)
+* 입력값: value(analyze()에 준 CSR 구조와 같은 순서의 값)
+* 출력값: 분해 성공 여부(analyze()를 하지 않았거나, pivot이 행의 가장 큰 값의 LU_PIVOT_THRESHOLD배 이하인 경우 거짓)
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+bool Sparse_LU<T>::factor(const std::vector<T>& value)
+{
+    isFactored = false;
+    failedRow = -1;
+    if (!isAnalyzed || value.size() != valueMap.size())
+    {
+        return false;
+    }
+
+    // 입력 행렬의 값을 L, U의 위치에 저장한다. (같은 위치의 값이 여러 개인 경우, 더한다.)
+    std::fill(luValue.begin(), luValue.end(), T(0));
+    for (unsigned long long int i = 0; i < value.size(); i++)
+    {
+        luValue[valueMap[i]] += value[i];
+    }
+
+    // 현재 행의 값을 열 위치에 펼쳐 둔 공간(현재 행의 열 위치 외에는 0)
+    std::vector<T> rowValue(matrixSize, T(0));
+
+    for (long long int row = 0; row < matrixSize; row++)
+    {
+        double rowScale = 0;
+        for (long long int cursor = luRowPtr[row]; cursor < luRowPtr[row + 1]; cursor++)
+        {
+            rowValue[luColIdx[cursor]] = luValue[cursor];
+            rowScale = std::max<double>(rowScale, std::abs(luValue[cursor]));
+        }
+
+        // L 부분의 값을 앞선 행의 U로 소거한다.
+        for (long long int cursor = luRowPtr[row]; cursor < diagPtr[row]; cursor++)
+        {
+            long long int pivotRow = luColIdx[cursor];
+            T multiplier = rowValue[pivotRow] / luValue[diagPtr[pivotRow]];
+
+            rowValue[pivotRow] = multiplier;
+            for (long long int pivotCursor = diagPtr[pivotRow] + 1; pivotCursor < luRowPtr[pivotRow + 1]; pivotCursor++)
+            {
+                subtractProduct(rowValue[luColIdx[pivotCursor]], multiplier, luValue[pivotCursor]);
+            }
+        }
+
+        for (long long int cursor = luRowPtr[row]; cursor < luRowPtr[row + 1]; cursor++)
+        {
+            luValue[cursor] = rowValue[luColIdx[cursor]];
+            rowValue[luColIdx[cursor]] = T(0);
+        }
+
+        // pivot이 0이거나 행의 다른 값에 비해 너무 작은 경우, 분해할 수 없다.
+        if (std::abs(luValue[diagPtr[row]]) <= LU_PIVOT_THRESHOLD * rowScale)
+        {
+            failedRow = pivotOrder[row];
+            return false;
+        }
+    }
+
+    isFactored = true;
+
+    return true;
+}
+
+/* Sparse_LU::solve() 함수
+*
+* 기능: 분해한 행렬 A에 대해 A x = b를 푼다. (전진 대입 후 후진 대입)
+*       분해 결과를 바꾸지 않으므로, 여러 thread에서 동시에 호출할 수 있다.
+* 입력값: rhs(b, 결과 x도 이곳에 저장한다.)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+void Sparse_LU<T>::solve(std::vector<T>& rhs) const
+{
+    std::vector<T> work;
+    solve(rhs, work);
+
+    return;
+}
+
+/* Sparse_LU::solve() 함수
+*
+* 기능: solve(rhs)와 같으나, 계산에 사용할 공간을 호출한 쪽에서 받는다. (같은 공간으로 반복하여 풀 때 매번 할당하지 않는다.)
+* 입력값: rhs(b, 결과 x도 이곳에 저장한다.), work(계산에 사용할 공간, 크기가 다르면 맞춘다.)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+void Sparse_LU<T>::solve(std::vector<T>& rhs, std::vector<T>& work) const
+{
+    work.resize(matrixSize);
+
+    // 분해 순서로 바꾼다.
+    for (long long int k = 0; k < matrixSize; k++)
+    {
+        work[k] = rhs[pivotOrder[k]];
+    }
+
+    // 전진 대입(L y = b)
+    for (long long int row = 0; row < matrixSize; row++)
+    {
+        T sum = work[row];
+        for (long long int cursor = luRowPtr[row]; cursor < diagPtr[row]; cursor++)
+        {
+            sum -= luValue[cursor] * work[luColIdx[cursor]];
+        }
+        work[row] = sum;
+    }
+
+    // 후진 대입(U x = y)
+    for (long long int row = matrixSize - 1; row >= 0; row--)
+    {
+        T sum = work[row];
+        for (long long int cursor = diagPtr[row] + 1; cursor < luRowPtr[row + 1]; cursor++)
+        {
+            sum -= luValue[cursor] * work[luColIdx[cursor]];
+        }
+        work[row] = sum / luValue[diagPtr[row]];
+    }
+
+    // 원래 순서로 되돌린다.
+    for (long long int k = 0; k < matrixSize; k++)
+    {
+        rhs[pivotOrder[k]] = work[k];
+    }
+
+    return;
+}
+
+/* Sparse_LU::size() 함수
+*
+* 기능: 행렬의 크기를 반환한다.
+* 입력값 없음
+* 출력값: 행렬의 크기
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+long long int Sparse_LU<T>::size() const
+{
+    return matrixSize;
+}
+
+/* Sparse_LU::factorNonzeros() 함수
+*
+* 기능: fill-in을 포함한 L, U의 0이 아닌 값의 수를 반환한다.
+* 입력값 없음
+* 출력값: L, U의 0이 아닌 값의 수
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+long long int Sparse_LU<T>::factorNonzeros() const
+{
+    return luColIdx.size();
+}
+
+/* Sparse_LU::failedPivot() 함수
+*
+* 기능: 마지막 factor()에서 pivot이 너무 작아 분해하지 못한 원래 행의 위치를 반환한다.
+* 입력값 없음
+* 출력값: 행의 위치(분해에 성공했거나, pivot 이외의 이유로 실패한 경우 -1)
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+long long int Sparse_LU<T>::failedPivot() const
+{
+    return failedRow;
+}
+
+bool factorMatrix(const Y_Matrix_CSR& matrixCSR, Sparse_LU<std::complex<double>>& matrixLU, double& analyzeTime, double& factorTime, std::string& errorMessage);
+
+#endif // Y_MATRIX_SPARSE_LU_HPP
@@ -0,0 +1,386 @@
+﻿#include<iostream>
+#include<iomanip>
+#include<chrono>
+
+#include "spmv.hpp"
+
+// SpMM에서 한 번에 계산하는 전압의 수(각 행의 값을 한 번 읽어 이 수만큼의 전압에 곱한다.)
+const long long int SPMM_BLOCK_SIZE = 8;
+
+/* Sparse_Multiplier의 생성자
+*
+* 기능: CSR 형태의 Y-Matrix에서 곱셈에 사용할 구조와 값을 만들고, 0이 아닌 값의 수가 고르도록 행을 threadCount개로 나눈 뒤,
+*       1번 이후의 block을 계산할 thread를 만든다.
+* 입력값: matrixCSR, threadCount
+* 최종 수정일: 2026/10/17
+*/
+Sparse_Multiplier::Sparse_Multiplier(const Y_Matrix_CSR& matrixCSR, int threadCount)
+{
+    rowCount = matrixCSR.nodeNum.size();
+    rowPtr = matrixCSR.rowPtr;
+    value.resize(matrixCSR.colIdx.size());
+    for (unsigned long long int i = 0; i < matrixCSR.colIdx.size(); i++)
+    {
+        value[i] = std::complex<double>((double)matrixCSR.G[i], (double)matrixCSR.jB[i]);
+    }
+
+    // 열 위치가 32bit에 들어가는 경우에만 줄여서 저장한다.
+    if (rowCount <= (long long int)UINT32_MAX + 1)
+    {
+        colIdx32.resize(matrixCSR.colIdx.size());
+        for (unsigned long long int i = 0; i < matrixCSR.colIdx.size(); i++)
+        {
+            colIdx32[i] = (uint32_t)matrixCSR.colIdx[i];
+        }
+    }else{
+        colIdx64 = matrixCSR.colIdx;
+    }
+
+    // t번째 block은 0이 아닌 값의 (t / threadCount) 위치를 넘는 첫 행부터 시작한다.
+    blockStart.assign(threadCount + 1, rowCount);
+    blockStart[0] = 0;
+    for (int t = 1; t < threadCount; t++)
+    {
+        long long int target = (long long int)((double)rowPtr[rowCount] * t / threadCount);
+        blockStart[t] = std::lower_bound(rowPtr.begin(), rowPtr.end() - 1, target) - rowPtr.begin();
+    }
+
+    // 0번 block은 multiply()를 호출한 thread가 계산한다.
+    generation = 0;
+    runningCount = 0;
+    taskV = NULL;
+    taskI = NULL;
+    taskRhsCount = 0;
+    isStopping = false;
+    for (int t = 1; t < threadCount; t++)
+    {
+        worker.emplace_back(&Sparse_Multiplier::runWorker, this, t);
+    }
+
+    return;
+}
+
+/* Sparse_Multiplier의 소멸자
+*
+* 기능: 계산할 thread를 멈추고 기다린다.
+* 최종 수정일: 2026/10/17
+*/
+Sparse_Multiplier::~Sparse_Multiplier()
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        isStopping = true;
+    }
+    startSignal.notify_all();
+    for (std::thread& thread : worker)
+    {
+        thread.join();
+    }
+}
+
+/* Sparse_Multiplier::runWorker() 함수
+*
+* 기능: 새 곱셈이 주어질 때마다 주어진 block을 계산하고, 마지막으로 끝낸 thread가 multiply()에 알린다. 소멸할 때까지 반복한다.
+* 입력값: block(계산할 block의 번호)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Sparse_Multiplier::runWorker(long long int block)
+{
+    unsigned long long int doneGeneration = 0;
+    std::unique_lock<std::mutex> lock(poolMutex);
+
+    while (true)
+    {
+        startSignal.wait(lock, [&]() { return isStopping || generation != doneGeneration; });
+        if (isStopping)
+        {
+            break;
+        }
+        doneGeneration = generation;
+        const std::complex<double>* V = taskV;
+        std::complex<double>* I = taskI;
+        long long int rhsCount = taskRhsCount;
+
+        lock.unlock();
+        multiplyBlock(block, V, I, rhsCount);
+        lock.lock();
+
+        if (--runningCount == 0)
+        {
+            finishSignal.notify_one();
+        }
+    }
+
+    return;
+}
+
+/* Sparse_Multiplier::multiplyRow() 함수
+*
+* 기능: 주어진 행에 대해, rhsStart번째부터 Width개의 전압과의 곱을 계산한다.
+*       전압과 전류는 node마다 rhsCount개씩 이어서 저장되어 있다. (V[node * rhsCount + k])
+*       복소수 곱은 실수부와 허수부로 나누어 직접 계산한다. (std::complex의 곱은 NaN 확인 때문에 느리다.)
+* 입력값: row(계산할 행), column(열 위치 배열), V, I(전압과 전류), rhsCount(전압의 수), rhsStart(계산할 첫 번째 전압의 위치)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <long long int Width, typename IndexT>
+void Sparse_Multiplier::multiplyRow(long long int row, const IndexT* column, const std::complex<double>* V, std::complex<double>* I, long long int rhsCount, long long int rhsStart) const
+{
+    const double* voltage = reinterpret_cast<const double*>(V);
+    double* current = reinterpret_cast<double*>(I);
+    double sumReal[Width] = {}, sumImag[Width] = {};
+
+    for (long long int cursor = rowPtr[row]; cursor < rowPtr[row + 1]; cursor++)
+    {
+        double G = value[cursor].real(), B = value[cursor].imag();
+        const double* columnVoltage = voltage + 2 * ((long long int)column[cursor] * rhsCount + rhsStart);
+
+        for (long long int k = 0; k < Width; k++)
+        {
+            sumReal[k] += G * columnVoltage[2 * k] - B * columnVoltage[2 * k + 1];
+            sumImag[k] += G * columnVoltage[2 * k + 1] + B * columnVoltage[2 * k];
+        }
+    }
+
+    double* output = current + 2 * (row * rhsCount + rhsStart);
+    for (long long int k = 0; k < Width; k++)
+    {
+        output[2 * k] = sumReal[k];
+        output[2 * k + 1] = sumImag[k];
+    }
+
+    return;
+}
+
+/* Sparse_Multiplier::multiplyBlock() 함수
+*
+* 기능: 주어진 범위의 행에 대해 모든 전압과의 곱을 계산한다. 행마다 전압을 SPMM_BLOCK_SIZE개씩 묶어 계산하고, 남은 전압은 SPMM_BLOCK_SIZE / 2개, 1개씩 계산한다.
+*       한 행의 계산을 마친 뒤 다음 행으로 넘어가므로, 행의 값과 각 열의 전압(K개가 이어져 있음)을 cache에 있는 동안 모두 사용한다.
+* 입력값: rowBegin, rowEnd(계산할 행의 범위), column(열 위치 배열), V, I(전압과 전류), rhsCount(전압의 수)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename IndexT>
+void Sparse_Multiplier::multiplyBlock(long long int rowBegin, long long int rowEnd, const IndexT* column, const std::complex<double>* V, std::complex<double>* I, long long int rhsCount) const
+{
+    for (long long int row = rowBegin; row < rowEnd; row++)
+    {
+        long long int rhsStart = 0;
+
+        for (; rhsStart + SPMM_BLOCK_SIZE <= rhsCount; rhsStart += SPMM_BLOCK_SIZE)
+        {
+            multiplyRow<SPMM_BLOCK_SIZE>(row, column, V, I, rhsCount, rhsStart);
+        }
+        if (rhsStart + SPMM_BLOCK_SIZE / 2 <= rhsCount)
+        {
+            multiplyRow<SPMM_BLOCK_SIZE / 2>(row, column, V, I, rhsCount, rhsStart);
+            rhsStart += SPMM_BLOCK_SIZE / 2;
+        }
+        for (; rhsStart < rhsCount; rhsStart++)
+        {
+            multiplyRow<1>(row, column, V, I, rhsCount, rhsStart);
+        }
+    }
+
+    return;
+}
+
+/* Sparse_Multiplier::multiplyBlock() 함수
+*
+* 기능: 주어진 번호의 block에 대해 모든 전압과의 곱을 계산한다. (저장한 열 위치의 형식에 맞는 함수를 호출한다.)
+* 입력값: block(block의 번호), V, I(전압과 전류), rhsCount(전압의 수)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Sparse_Multiplier::multiplyBlock(long long int block, const std::complex<double>* V, std::complex<double>* I, long long int rhsCount) const
+{
+    if (colIdx64.empty())
+    {
+        multiplyBlock(blockStart[block], blockStart[block + 1], colIdx32.data(), V, I, rhsCount);
+    }else{
+        multiplyBlock(blockStart[block], blockStart[block + 1], colIdx64.data(), V, I, rhsCount);
+    }
+
+    return;
+}
+
+/* Sparse_Multiplier::multiply() 함수
+*
+* 기능: I = Y V 를 계산한다. (SpMV)
+* 입력값: V(각 행의 전압), I(각 행의 전류를 저장할 공간)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Sparse_Multiplier::multiply(std::span<const std::complex<double>> V, std::span<std::complex<double>> I) const
+{
+    multiply(V, I, 1);
+
+    return;
+}
+
+/* Sparse_Multiplier::multiply() 함수
+*
+* 기능: K개의 전압에 대해 I = Y V 를 한 번에 계산한다. (SpMM) 전압과 전류는 node마다 K개씩 이어서 저장한다. (V[row * K + k])
+*       행을 나눈 block마다 thread 하나가 계산하며, 0번 block은 호출한 thread가 계산한다. (생성할 때 만든 thread를 다시 사용한다.)
+*       여러 thread에서 동시에 호출한 경우, 하나씩 차례대로 계산한다.
+* 입력값: V, I(전압과 전류, 길이는 행의 수 * rhsCount), rhsCount(전압의 수, K)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Sparse_Multiplier::multiply(std::span<const std::complex<double>> V, std::span<std::complex<double>> I, long long int rhsCount) const
+{
+    if (worker.empty())
+    {
+        multiplyBlock(0, V.data(), I.data(), rhsCount);
+        return;
+    }
+
+    std::lock_guard<std::mutex> callLock(callMutex);
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        taskV = V.data();
+        taskI = I.data();
+        taskRhsCount = rhsCount;
+        runningCount = worker.size();
+        generation++;
+    }
+    startSignal.notify_all();
+
+    multiplyBlock(0, V.data(), I.data(), rhsCount);
+
+    std::unique_lock<std::mutex> lock(poolMutex);
+    finishSignal.wait(lock, [&]() { return runningCount == 0; });
+
+    return;
+}
+
+/* Sparse_Multiplier::size() 함수
+*
+* 기능: 행의 수를 반환한다.
+* 입력값 없음
+* 출력값: 행의 수
+* 최종 수정일: 2026/10/17
+*/
+long long int Sparse_Multiplier::size() const
+{
+    return rowCount;
+}
+
+/* Sparse_Multiplier::nonzeroCount() 함수
+*
+* 기능: 0이 아닌 값의 수를 반환한다.
+* 입력값 없음
+* 출력값: 0이 아닌 값의 수
+* 최종 수정일: 2026/10/17
+*/
+long long int Sparse_Multiplier::nonzeroCount() const
+{
+    return value.size();
+}
+
+/* multiplyVoltage() 함수
+*
+* 기능: 전압 파일을 읽어 I = Y V 를 계산하고, 각 node의 전류를 CSV 형식(node,I_real,I_imag)으로 출력한다.
+*       전압 파일의 양식은 (Node) (전압 실수부) (전압 허수부) ... 이며, 한 줄에 K개의 전압을 주면(실수부, 허수부를 K번 반복)
+*       K개의 전압을 한 번에 곱하여(SpMM) node,I1_real,I1_imag,I2_real,I2_imag,... 형식으로 출력한다. K는 첫 번째 줄의 값의 수로 정한다.
+*       주어지지 않은 node의 전압은 0으로 하며, 곱셈에 걸린 시간과 처리량(GFLOP/s)은 표준 오류로 출력한다.
+* 입력값: matrixCSR, voltagePath(전압 파일의 위치), threadCount, writer
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool multiplyVoltage(const Y_Matrix_CSR& matrixCSR, const std::string& voltagePath, int threadCount, Output_Writer& writer)
+{
+    Mapped_File voltageFile;
+    std::vector<long long int> voltageNode;
+    std::vector<long double> voltageValue;
+    std::string errorMessage;
+
+    if (!voltageFile.open(voltagePath))
+    {
+        std::cout << "Voltage File Not Found" << std::endl;
+        return false;
+    }
+
+    // 첫 번째 줄(빈 줄 제외)의 값의 수로 전압의 수를 정한다.
+    long long int fieldCount = 0;
+    {
+        const char* cursor = voltageFile.data();
+        const char* fileEnd = cursor + voltageFile.size();
+        while (cursor < fileEnd && fieldCount == 0)
+        {
+            bool isField = false;
+            for (; cursor < fileEnd && *cursor != '\n'; cursor++)
+            {
+                bool isSpace = (*cursor == ' ' || *cursor == '\t' || *cursor == '\r');
+                if (!isSpace && !isField)
+                {
+                    fieldCount++;
+                }
+                isField = !isSpace;
+            }
+            cursor++;
+        }
+    }
+    long long int rhsCount = (fieldCount - 1) / 2;
+    if (fieldCount < 3 || fieldCount % 2 == 0)
+    {
+        std::cout << "Invalid Voltage File - Line 1: Invalid Format" << std::endl;
+        return false;
+    }
+    if (!parseNodeValueFile(voltageFile.data(), voltageFile.size(), rhsCount * 2, voltageNode, voltageValue, errorMessage))
+    {
+        std::cout << "Invalid Voltage File - " << errorMessage << std::endl;
+        return false;
+    }
+    voltageFile.close();
+
+    // 전압을 Y-Matrix의 행 순서로 정리한다.
+    long long int busCount = matrixCSR.nodeNum.size();
+    std::vector<std::complex<double>> voltage(busCount * rhsCount, 0), current(busCount * rhsCount);
+    for (unsigned long long int i = 0; i < voltageNode.size(); i++)
+    {
+        long long int row = matrixCSR.findRow(voltageNode[i]);
+        if (row == -1)
+        {
+            std::cout << "Unknown Node in Voltage File: " << voltageNode[i] << std::endl;
+            return false;
+        }
+        for (long long int k = 0; k < rhsCount; k++)
+        {
+            voltage[row * rhsCount + k] += std::complex<double>((double)voltageValue[(i * rhsCount + k) * 2], (double)voltageValue[(i * rhsCount + k) * 2 + 1]);
+        }
+    }
+
+    // I = Y V
+    Sparse_Multiplier multiplier(matrixCSR, threadCount);
+    auto startTime = std::chrono::steady_clock::now();
+    multiplier.multiply(voltage, current, rhsCount);
+    double multiplyTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    // 전류 출력
+    writer.writeText("node");
+    for (long long int k = 1; k <= rhsCount; k++)
+    {
+        std::string label = rhsCount == 1 ? "" : std::to_string(k);
+        writer.writeText((",I" + label + "_real,I" + label + "_imag").c_str());
+    }
+    writer.writeChar('\n');
+    for (long long int row = 0; row < busCount; row++)
+    {
+        writer.writeInt(matrixCSR.nodeNum[row]);
+        for (long long int k = 0; k < rhsCount; k++)
+        {
+            writer.writeChar(',');
+            writer.writeReal(current[row * rhsCount + k].real());
+            writer.writeChar(',');
+            writer.writeReal(current[row * rhsCount + k].imag());
+        }
+        writer.writeChar('\n');
+    }
+
+    std::cerr << std::fixed << std::setprecision(3) << "Nonzeros: " << multiplier.nonzeroCount() << ", RHS: " << rhsCount << ", Threads: " << threadCount
+        << ", Time: " << multiplyTime << " ms, " << 8.0 * multiplier.nonzeroCount() * rhsCount / (multiplyTime * 1e6) << " GFLOP/s" << std::endl;
+
+    return true;
+}
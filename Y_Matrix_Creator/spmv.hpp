@@ -0,0 +1,81 @@
+﻿/* spmv.hpp
+*
+* CSR 형태의 Y-Matrix와 복소수 전압의 곱(I = Y V)을 여러 thread로 계산한다. (--multiply 옵션)
+*/
+#ifndef Y_MATRIX_SPMV_HPP
+#define Y_MATRIX_SPMV_HPP
+
+#include<vector>
+#include<complex>
+#include<span>
+#include<string>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+
+#include "io.hpp"
+
+/* Sparse_Multiplier 클래스
+*
+* 기능: CSR 형태의 Y-Matrix와 복소수 전압의 곱(I = Y V)을 계산한다. 전압이 1개인 경우(SpMV)와 K개인 경우(SpMM)를 모두 계산한다.
+*       생성할 때 값을 double 복소수로, 열 위치를 32bit로(행의 수가 32bit를 넘는 경우 64bit 그대로) 바꾸고, 0이 아닌 값의 수가 고르도록
+*       행을 thread 수만큼 나누어 두므로, 같은 Y-Matrix로 여러 번 곱하는 경우 구조를 다시 만들지 않는다.
+*       계산할 thread도 생성할 때 한 번만 만들어 두고, 곱할 때마다 깨워 다시 사용한다.
+*       각 행은 하나의 thread만 계산하므로, thread 수와 관계없이 결과가 bit 단위로 같다.
+* 최종 수정일: 2026/10/17
+*/
+class Sparse_Multiplier{
+private:
+    // 행의 수
+    long long int rowCount;
+
+    // CSR 형태의 구조와 값(열 위치는 colIdx32, colIdx64 중 하나만 사용한다.)
+    std::vector<long long int> rowPtr;
+    std::vector<uint32_t> colIdx32;
+    std::vector<long long int> colIdx64;
+    std::vector<std::complex<double>> value;
+
+    // thread별로 계산할 행의 범위(blockStart[t]부터 blockStart[t + 1] 전까지)
+    std::vector<long long int> blockStart;
+
+    // 1번 이후의 block을 계산하는 thread와, thread에 전달할 곱셈(generation은 새 곱셈마다 1씩 늘어난다.)
+    std::vector<std::thread> worker;
+    mutable std::mutex callMutex, poolMutex;
+    mutable std::condition_variable startSignal, finishSignal;
+    mutable unsigned long long int generation;
+    mutable long long int runningCount;
+    mutable const std::complex<double>* taskV;
+    mutable std::complex<double>* taskI;
+    mutable long long int taskRhsCount;
+    bool isStopping;
+
+    template <long long int Width, typename IndexT>
+    void multiplyRow(long long int row, const IndexT* column, const std::complex<double>* V, std::complex<double>* I, long long int rhsCount, long long int rhsStart) const;
+
+    template <typename IndexT>
+    void multiplyBlock(long long int rowBegin, long long int rowEnd, const IndexT* column, const std::complex<double>* V, std::complex<double>* I, long long int rhsCount) const;
+
+    void multiplyBlock(long long int block, const std::complex<double>* V, std::complex<double>* I, long long int rhsCount) const;
+
+    void runWorker(long long int block);
+
+public:
+Sparse_Multiplier(const Y_Matrix_CSR& matrixCSR, int threadCount);
+~Sparse_Multiplier();
+
+Sparse_Multiplier(const Sparse_Multiplier&) = delete;
+Sparse_Multiplier& operator=(const Sparse_Multiplier&) = delete;
+
+void multiply(std::span<const std::complex<double>> V, std::span<std::complex<double>> I) const;
+
+void multiply(std::span<const std::complex<double>> V, std::span<std::complex<double>> I, long long int rhsCount) const;
+
+long long int size() const;
+
+long long int nonzeroCount() const;
+
+};
+
+bool multiplyVoltage(const Y_Matrix_CSR& matrixCSR, const std::string& voltagePath, int threadCount, Output_Writer& writer);
+
+#endif // Y_MATRIX_SPMV_HPP
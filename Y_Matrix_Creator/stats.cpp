@@ -0,0 +1,31 @@
+﻿#include "stats.hpp"
+
+#if Y_MATRIX_STATS
+// 실행 통계를 기록하는지 여부(--stats 옵션, 다른 thread를 만들기 전에 정한다.)
+bool isStatsEnabled = false;
+
+// 끝난 thread의 counter 합계
+std::atomic<unsigned long long int> statsTotal[STAT_COUNTER_COUNT];
+
+// 각 thread의 counter
+thread_local Stats_Counter statsCounter;
+
+// 각 단계에 걸린 시간(ns)과, 진행중인 단계의 시작 시각
+unsigned long long int statsPhaseNs[STAT_PHASE_COUNT];
+std::chrono::steady_clock::time_point statsPhaseStart[STAT_PHASE_COUNT];
+
+/* Stats_Counter의 소멸자
+*
+* 기능: thread가 끝날 때, 해당 thread의 counter 값을 전체 합계에 더한다.
+* 최종 수정일: 2026/10/17
+*/
+Stats_Counter::~Stats_Counter()
+{
+    for (int i = 0; i < STAT_COUNTER_COUNT; i++)
+    {
+        statsTotal[i].fetch_add(value[i], std::memory_order_relaxed);
+    }
+
+    return;
+}
+#endif
@@ -0,0 +1,95 @@
+﻿/* stats.hpp
+*
+* 주요 함수의 호출 횟수(counter)와 단계별 걸린 시간을 기록한다. (--stats 옵션)
+*/
+#ifndef Y_MATRIX_STATS_HPP
+#define Y_MATRIX_STATS_HPP
+
+#include<atomic>
+#include<chrono>
+
+/* 실행 통계
+*
+* Y_MATRIX_STATS가 0이 아닌 경우, 주요 함수의 호출 횟수(counter)와 단계별 걸린 시간을 기록하여 --stats 옵션으로 JSON 형식으로 출력한다.
+* counter는 thread마다 따로(thread_local) 더하고, thread가 끝날 때 전체 합계에 더하므로, 더할 때 잠금이나 atomic 연산을 사용하지 않는다.
+* --stats 옵션을 주지 않은 경우(isStatsEnabled가 거짓) 기록하지 않으며, 자주 호출되는 함수는 호출 안에서 센 값을 한 번에 더한다.
+* 단계별 시간은 main thread에서만 기록한다.
+* Y_MATRIX_STATS를 0으로 정의하여 compile하면(-DY_MATRIX_STATS=0), 기록하는 부분이 모두 사라진다.
+*/
+#ifndef Y_MATRIX_STATS
+#define Y_MATRIX_STATS 1
+#endif
+
+// counter의 종류
+enum Stats_Counter_Id
+{
+    STAT_LOOKUP,       // Y_Matrix::findMatrix() 호출 수
+    STAT_PROBE,        // Y_Matrix::findSlot()에서 확인한 hashTable 칸의 수
+    STAT_INSERT,       // Y_Matrix에 새로 저장한 값의 수
+    STAT_ERASE,        // 0이 되어 제거한 값의 수
+    STAT_ERASE_SHIFT,  // 값을 제거할 때 앞으로 당긴 hashTable 칸의 수
+    STAT_REHASH,       // hashTable을 다시 만든 횟수
+    STAT_ROW_SEARCH,   // Y_Matrix_CSR::findRow() 호출 수
+    STAT_PARSE_BYTE,   // 읽은 입력 파일의 크기(Byte)
+    STAT_PARSE_LINE,   // 읽은 입력 파일의 줄 수
+    STAT_OUTPUT_BYTE,  // 출력한 크기(Byte)
+    STAT_STREAM_EVENT, // 적용한 변경 기록의 수
+    STAT_SCENARIO,     // 구성한 시나리오의 수
+    STAT_SERVE_REQUEST,// server가 처리한 요청의 수
+    STAT_COUNTER_COUNT
+};
+
+// 시간을 기록하는 단계
+enum Stats_Phase_Id
+{
+    PHASE_READ,        // 입력 파일 열기(Binary 파일 읽기 포함)
+    PHASE_PARSE,       // 입력 파일 해석
+    PHASE_ASSEMBLY,    // Y-Matrix 구성
+    PHASE_FREEZE,      // CSR 형태로 변환
+    PHASE_KRON,        // Kron 축약
+    PHASE_REORDER,     // 행과 열의 순서 변경
+    PHASE_ANALYSIS,    // 전압, 전력 조류, 상정 사고, 고장, 곱셈 계산
+    PHASE_OUTPUT,      // 행렬 출력
+    PHASE_STREAM,      // 변경 기록 적용과 출력
+    PHASE_SCENARIO,    // 시나리오 구성과 저장
+    PHASE_SERVE,       // server 실행(요청을 받기 시작한 뒤 종료할 때까지)
+    STAT_PHASE_COUNT
+};
+
+#if Y_MATRIX_STATS
+/* Stats_Counter 구조체
+ *
+ * 기능: 한 thread의 counter 값을 저장한다. thread가 끝날 때(소멸자) 전체 합계에 더한다.
+ * 인수: value(각 counter의 값)
+ * 최종 수정일: 2026/10/17
+*/
+struct Stats_Counter
+{
+    unsigned long long int value[STAT_COUNTER_COUNT] = {};
+
+    ~Stats_Counter();
+};
+
+// 실행 통계를 기록하는지 여부(--stats 옵션, 다른 thread를 만들기 전에 정한다.)
+extern bool isStatsEnabled;
+
+// 끝난 thread의 counter 합계
+extern std::atomic<unsigned long long int> statsTotal[STAT_COUNTER_COUNT];
+
+// 각 thread의 counter
+extern thread_local Stats_Counter statsCounter;
+
+// 각 단계에 걸린 시간(ns)과, 진행중인 단계의 시작 시각
+extern unsigned long long int statsPhaseNs[STAT_PHASE_COUNT];
+extern std::chrono::steady_clock::time_point statsPhaseStart[STAT_PHASE_COUNT];
+
+#define STATS_ADD(counter, count) (isStatsEnabled ? (void)(statsCounter.value[counter] += (count)) : (void)0)
+#define STATS_PHASE_BEGIN(phase) (isStatsEnabled ? (void)(statsPhaseStart[phase] = std::chrono::steady_clock::now()) : (void)0)
+#define STATS_PHASE_END(phase) (isStatsEnabled ? (void)(statsPhaseNs[phase] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - statsPhaseStart[phase]).count()) : (void)0)
+#else
+#define STATS_ADD(counter, count) ((void)(count))
+#define STATS_PHASE_BEGIN(phase) ((void)0)
+#define STATS_PHASE_END(phase) ((void)0)
+#endif
+
+#endif // Y_MATRIX_STATS_HPP
@@ -0,0 +1,244 @@
+﻿#include<cstring>
+
+#include "stream.hpp"
+
+/* readStreamLine() 함수
+*
+* 기능: 파일(pipe 포함)에서 한 줄을 읽는다. 줄바꿈 문자와 줄 끝의 '\r'은 저장하지 않는다.
+* 입력값: inputFile, line(읽은 줄을 저장할 문자열)
+* 출력값: 한 줄을 읽은 경우 참을, 더 읽을 내용이 없는 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+bool readStreamLine(FILE* inputFile, std::string& line)
+{
+    char chunk[4096];
+    bool isRead = false;
+
+    line.clear();
+    while (fgets(chunk, sizeof(chunk), inputFile) != NULL)
+    {
+        unsigned long long int length = strlen(chunk);
+        isRead = true;
+
+        // 줄바꿈 문자까지 읽은 경우, 한 줄을 모두 읽었다.
+        if (length > 0 && chunk[length - 1] == '\n')
+        {
+            line.append(chunk, length - 1);
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            return true;
+        }
+        line.append(chunk, length);
+    }
+
+    return isRead;
+}
+
+/* parseChangeRecord() 함수
+*
+* 기능: 변경 기록 한 줄((+/-) (Node1) (Node2) (R) (L) (C))을 읽는다. 선로 부분은 parseBranchFile()로 읽는다.
+* 입력값: line(앞의 빈칸을 뺀 한 줄), change(읽은 선로 정보), isAdd(추가인 경우 참, 제거인 경우 거짓), errorMessage(형식에 맞지 않는 이유)
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool parseChangeRecord(const std::string& line, Branch_Val& change, bool& isAdd, std::string& errorMessage)
+{
+    std::vector<Branch_Val> record;
+
+    if (line.empty() || (line[0] != '+' && line[0] != '-'))
+    {
+        errorMessage = "Missing +/- Sign";
+        return false;
+    }
+    isAdd = line[0] == '+';
+
+    errorMessage.clear();
+    if (!parseBranchFile(line.data() + 1, line.size() - 1, record, errorMessage) || record.size() != 1)
+    {
+        // parseBranchFile()의 오류 내용에서 줄 번호와 줄의 내용을 뺀 부분만 사용한다.
+        errorMessage = errorMessage.empty() ? "Too Few Values" : errorMessage.substr(errorMessage.find(':') + 2, errorMessage.find(" (") - errorMessage.find(':') - 2);
+        return false;
+    }
+    change = record[0];
+
+    return true;
+}
+
+/* parseTapRecord() 함수
+*
+* 기능: 변경 기록의 tap 변경 한 줄(~ (Node1) (Node2) (tap) (shift))을 읽는다.
+* 입력값: line(앞의 빈칸을 뺀 한 줄), Node1, Node2(변압기의 두 node), tap, shift(바뀐 tap 비와 위상 변위(도)), errorMessage(형식에 맞지 않는 이유)
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool parseTapRecord(const std::string& line, long long int& Node1, long long int& Node2, long double& tap, long double& shift, std::string& errorMessage)
+{
+    const char* cursor = line.data() + 1;
+    const char* lineEnd = line.data() + line.size();
+    long long int* nodeField[2] = { &Node1, &Node2 };
+    long double* realField[2] = { &tap, &shift };
+    int fieldCount = 0;
+    std::from_chars_result result;
+
+    while (cursor < lineEnd)
+    {
+        // 빈칸 넘기기
+        if (*cursor == ' ' || *cursor == '\t')
+        {
+            cursor++;
+            continue;
+        }
+        if (fieldCount == 4)
+        {
+            errorMessage = "Too Many Values";
+            return false;
+        }
+        cursor = skipPlusSign(cursor, lineEnd);
+
+        // node 번호는 정수로, 나머지 값은 실수로 읽는다.
+        if (fieldCount < 2)
+        {
+            result = std::from_chars(cursor, lineEnd, *nodeField[fieldCount]);
+        }else{
+            result = parseRealValue(cursor, lineEnd, *realField[fieldCount - 2]);
+        }
+        if (result.ec != std::errc() || (result.ptr < lineEnd && *result.ptr != ' ' && *result.ptr != '\t'))
+        {
+            errorMessage = "Invalid Value";
+            return false;
+        }
+        cursor = result.ptr;
+        fieldCount++;
+    }
+
+    if (fieldCount != 4)
+    {
+        errorMessage = "Too Few Values";
+        return false;
+    }
+    if (!(tap > 0))
+    {
+        errorMessage = "Invalid Tap Ratio";
+        return false;
+    }
+
+    return true;
+}
+
+/* isBranchLess() 함수
+*
+* 기능: 두 선로를 (Node1, Node2, R, L, C) 순서로 비교한다. NaN은 다른 모든 값보다 크고 서로는 같은 것으로 본다.
+*       R, L, C는 Binary 파일에 저장되는 double로 반올림하여 비교한다. (Binary 파일에서 읽은 선로도 입력 파일과 같은 값으로 찾는다.)
+* 입력값: a, b(비교할 선로)
+* 출력값: a가 b보다 앞서는 경우 참
+* 최종 수정일: 2026/10/17
+*/
+bool isBranchLess(const Branch_Val& a, const Branch_Val& b)
+{
+    if (a.node1 != b.node1)
+    {
+        return a.node1 < b.node1;
+    }
+    if (a.node2 != b.node2)
+    {
+        return a.node2 < b.node2;
+    }
+
+    const double valueA[3] = { (double)a.R, (double)a.L, (double)a.C }, valueB[3] = { (double)b.R, (double)b.L, (double)b.C };
+    for (int i = 0; i < 3; i++)
+    {
+        bool isNanA = std::isnan(valueA[i]), isNanB = std::isnan(valueB[i]);
+        if (isNanA || isNanB)
+        {
+            if (isNanA != isNanB)
+            {
+                return isNanB;
+            }
+            continue;
+        }
+        if (valueA[i] != valueB[i])
+        {
+            return valueA[i] < valueB[i];
+        }
+    }
+
+    return false;
+}
+
+/* Branch_Counter의 생성자
+*
+* 기능: 주어진 선로를 기본 계통으로 하여, node 순서를 맞추어 정렬해 둔다.
+* 최종 수정일: 2026/10/17
+*/
+Branch_Counter::Branch_Counter(const std::vector<Branch_Val>& branch) : branchDelta(isBranchLess)
+{
+    std::vector<Branch_Val> sortedBranch;
+
+    sortedBranch.reserve(branch.size());
+    for (const Branch_Val& branchVal : branch)
+    {
+        sortedBranch.push_back(branchKey(branchVal));
+    }
+    std::sort(sortedBranch.begin(), sortedBranch.end(), isBranchLess);
+    baseBranch = std::make_shared<const std::vector<Branch_Val>>(std::move(sortedBranch));
+
+    return;
+}
+
+/* Branch_Counter::branchKey() 함수
+*
+* 기능: 선로의 node 순서를 Node1 <= Node2로 맞춘다.
+* 입력값: branchVal
+* 출력값: node 순서를 맞춘 선로
+* 최종 수정일: 2026/10/17
+*/
+Branch_Val Branch_Counter::branchKey(const Branch_Val& branchVal)
+{
+    Branch_Val key = branchVal;
+
+    if (key.node1 > key.node2)
+    {
+        std::swap(key.node1, key.node2);
+    }
+
+    return key;
+}
+
+/* Branch_Counter::addBranch() 함수
+*
+* 기능: 현재 계통에 선로 하나를 더한다.
+* 입력값: branchVal
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Branch_Counter::addBranch(const Branch_Val& branchVal)
+{
+    branchDelta[branchKey(branchVal)]++;
+
+    return;
+}
+
+/* Branch_Counter::removeBranch() 함수
+*
+* 기능: 현재 계통에서 선로 하나를 뺀다. 현재 계통에 해당 선로가 없는 경우, 바꾸지 않는다.
+* 입력값: branchVal
+* 출력값: 선로가 있어 뺀 경우 참
+* 최종 수정일: 2026/10/17
+*/
+bool Branch_Counter::removeBranch(const Branch_Val& branchVal)
+{
+    Branch_Val key = branchKey(branchVal);
+    auto baseRange = std::equal_range(baseBranch->begin(), baseBranch->end(), key, isBranchLess);
+    auto deltaLocation = branchDelta.find(key);
+    long long int delta = deltaLocation == branchDelta.end() ? 0 : deltaLocation->second;
+
+    if ((baseRange.second - baseRange.first) + delta <= 0)
+    {
+        return false;
+    }
+    branchDelta[key] = delta - 1;
+
+    return true;
+}
@@ -0,0 +1,228 @@
+﻿/* stream.hpp
+*
+* 변경 기록(+/- 선로, ~ 변압기 tap)의 해석과, 구성된 Y-Matrix에 변경을 바로 적용하는 streamChanges() (--stream 옵션)
+*/
+#ifndef Y_MATRIX_STREAM_HPP
+#define Y_MATRIX_STREAM_HPP
+
+#include<vector>
+#include<string>
+#include<map>
+#include<memory>
+#include<iostream>
+#include<iomanip>
+#include<chrono>
+
+#include "io.hpp"
+
+bool readStreamLine(FILE* inputFile, std::string& line);
+
+bool parseChangeRecord(const std::string& line, Branch_Val& change, bool& isAdd, std::string& errorMessage);
+
+bool parseTapRecord(const std::string& line, long long int& Node1, long long int& Node2, long double& tap, long double& shift, std::string& errorMessage);
+
+bool isBranchLess(const Branch_Val& a, const Branch_Val& b);
+
+/* Branch_Counter 클래스
+*
+* 기능: 현재 계통에 있는 선로(node 순서를 맞춘 (Node1, Node2, R, L, C))의 수를, 기본 계통의 정렬된 선로와 그 뒤의 증감으로 관리한다.
+*       기본 계통의 선로는 복사본끼리 공유하므로, 복사하면 증감만 복사된다. (변형 계통이 부모의 선로 수를 이어받는 데 사용)
+* 최종 수정일: 2026/10/17
+*/
+class Branch_Counter{
+private:
+    // 기본 계통의 선로(Node1 <= Node2로 맞추어 정렬)
+    std::shared_ptr<const std::vector<Branch_Val>> baseBranch;
+
+    // 기본 계통에 비해 늘어난(음수는 줄어든) 선로의 수
+    std::map<Branch_Val, long long int, decltype(&isBranchLess)> branchDelta;
+
+    static Branch_Val branchKey(const Branch_Val& branchVal);
+
+public:
+Branch_Counter(const std::vector<Branch_Val>& branch);
+
+void addBranch(const Branch_Val& branchVal);
+
+bool removeBranch(const Branch_Val& branchVal);
+
+};
+
+/* streamChanges() 함수
+*
+* 기능: 기본 계통으로 Y_Matrix<T, IndexT>를 구성한 뒤, 변경 기록(+ 선로 추가, - 선로 제거, ~ 변압기 tap 변경)을 한 줄씩 읽어 다시 구성하지 않고 바로 더하거나 뺀다.
+*       tap 변경은 입력 파일에서 같은 (Node1, Node2)로 처음 정의한 변압기의 tap 비와 위상 변위를 바꾸며, 해당 변압기의 4개의 위치만 수정한다.
+*       빈 줄 또는 입력의 끝에서 하나의 묶음(batch)이 끝나며, 묶음마다 값이 바뀐 위치만을 batch,node1,node2,G,jB 형식으로 출력한다. (node1 <= node2, 제거된 값은 0)
+*       위상 변위 변압기가 있는 경우, 상삼각 값과 다를 수 있는 하삼각 값(node1 > node2)도 바뀐 경우 출력한다.
+*       각 위치의 묶음 전 값은 처음 바뀔 때 기록해 두었다가, 묶음이 끝나면 위치 순서로 정렬하여 현재 값과 다른 위치만 출력한다.
+*       묶음마다 변경 수, 바뀐 위치의 수와 변경 1개당 적용에 걸린 시간(평균, 최대, μs)은 표준 오류로 출력한다.
+*       현재 계통에 있는 선로의 수를 Branch_Counter로 관리하며, 현재 계통에 없는 선로를 제거하는 기록은 오류로 처리한다.
+* 입력값: branch, device(기본 계통의 선로, 소자 정보), changeFile(변경 기록을 읽을 파일), writer
+* 출력값: 모든 변경을 적용한 경우 참을, 형식에 맞지 않는 줄이나 없는 선로를 제거하는 줄이 있는 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+bool streamChanges(const std::vector<Branch_Val>& branch, const std::vector<Device_Val>& device, FILE* changeFile, Output_Writer& writer)
+{
+    Y_Matrix<T, IndexT> yMatrix;
+    Branch_Val change; // 한 줄에서 읽은 선로 정보
+    bool isAdd; // 한 줄에서 읽은 변경이 추가인지 여부
+    std::vector<std::pair<std::pair<long long int, long long int>, std::complex<long double>>> touched; // 묶음에서 바뀐 위치와 바뀌기 전 값
+    std::vector<Device_Val> transformer; // 변압기 정보(현재 tap 비와 위상 변위), (Node1, Node2) 순서로 정렬
+    bool hasPhaseShift = false; // 위상 변위가 있는 변압기가 있는지 여부
+    Branch_Counter branchCounter(branch); // 현재 계통에 있는 선로의 수
+    std::string line, errorMessage;
+    long long int lineNumber = 0, batchNumber = 0, eventCount = 0;
+    double totalTime = 0, maxTime = 0; // 묶음에서 변경을 적용하는 데 걸린 시간의 합, 최댓값(μs)
+    bool isEnd = false;
+
+    yMatrix.addBranches(branch);
+    yMatrix.addDevices(device);
+
+    // tap 변경에서 찾을 수 있도록 변압기를 (Node1, Node2) 순서로 정렬한다. (같은 위치는 입력 파일의 순서를 유지한다.)
+    auto compareNode = [](const Device_Val& a, const Device_Val& b) {
+        return a.node1 != b.node1 ? a.node1 < b.node1 : a.node2 < b.node2;
+    };
+    for (const Device_Val& deviceVal : device)
+    {
+        if (deviceVal.type == DEVICE_TRANSFORMER)
+        {
+            transformer.push_back(deviceVal);
+            hasPhaseShift = hasPhaseShift || deviceVal.shift != 0;
+        }
+    }
+    std::stable_sort(transformer.begin(), transformer.end(), compareNode);
+
+    writer.writeText("batch,node1,node2,G,jB\n");
+    writer.flush();
+
+    while (!isEnd)
+    {
+        isEnd = !readStreamLine(changeFile, line);
+        if (!isEnd)
+        {
+            lineNumber++;
+        }
+
+        // 빈칸만 있는 줄은 빈 줄로 본다.
+        unsigned long long int first = line.find_first_not_of(" \t");
+        if (!isEnd && first != std::string::npos)
+        {
+            Device_Val* tapChange = NULL; // tap을 바꿀 변압기
+            long double tap, shift; // 바뀐 tap 비와 위상 변위
+
+            if (line[first] == '~')
+            {
+                Device_Val key = {};
+                if (!parseTapRecord(line.substr(first), key.node1, key.node2, tap, shift, errorMessage))
+                {
+                    std::cout << "Invalid Change Record - Line " << lineNumber << ": " << errorMessage << " (" << line << ")" << std::endl;
+                    return false;
+                }
+                auto location = std::lower_bound(transformer.begin(), transformer.end(), key, compareNode);
+                if (location == transformer.end() || location->node1 != key.node1 || location->node2 != key.node2)
+                {
+                    std::cout << "Invalid Change Record - Line " << lineNumber << ": Unknown Transformer (" << line << ")" << std::endl;
+                    return false;
+                }
+                tapChange = &*location;
+                change.node1 = key.node1;
+                change.node2 = key.node2;
+                hasPhaseShift = hasPhaseShift || shift != 0;
+            }else if (!parseChangeRecord(line.substr(first), change, isAdd, errorMessage))
+            {
+                std::cout << "Invalid Change Record - Line " << lineNumber << ": " << errorMessage << " (" << line << ")" << std::endl;
+                return false;
+            }else{
+                // 현재 계통의 선로 수를 바꾼다. 제거하는 경우, 현재 계통에 해당 선로가 있어야 한다.
+                if (isAdd)
+                {
+                    branchCounter.addBranch(change);
+                }else if (!branchCounter.removeBranch(change))
+                {
+                    std::cout << "Invalid Change Record - Line " << lineNumber << ": Branch Not Found (" << line << ")" << std::endl;
+                    return false;
+                }
+            }
+
+            // 바뀔 3개(위상 변위 변압기가 있는 경우 하삼각 값을 포함한 4개)의 위치의 값을 기록한다.
+            long long int Node1 = std::min(change.node1, change.node2), Node2 = std::max(change.node1, change.node2);
+            touched.push_back({ { Node1, Node1 }, yMatrix.getMatrix(Node1, Node1) });
+            touched.push_back({ { Node2, Node2 }, yMatrix.getMatrix(Node2, Node2) });
+            touched.push_back({ { Node1, Node2 }, yMatrix.getMatrix(Node1, Node2) });
+            if (hasPhaseShift && Node1 != Node2)
+            {
+                touched.push_back({ { Node2, Node1 }, yMatrix.getMatrix(Node2, Node1) });
+            }
+
+            auto startTime = std::chrono::steady_clock::now();
+            if (tapChange != NULL)
+            {
+                yMatrix.updateTap(tapChange->node1, tapChange->node2, tapChange->R, tapChange->L, tapChange->C, tapChange->tap, tapChange->shift, tap, shift);
+                tapChange->tap = tap;
+                tapChange->shift = shift;
+            }else if (isAdd)
+            {
+                yMatrix.addMatrixPackage(change.node1, change.node2, change.R, change.L, change.C);
+            }else{
+                yMatrix.subtractMatrixPackage(change.node1, change.node2, change.R, change.L, change.C);
+            }
+            double eventTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+
+            totalTime += eventTime;
+            maxTime = std::max(maxTime, eventTime);
+            eventCount++;
+            STATS_ADD(STAT_STREAM_EVENT, 1);
+            continue;
+        }
+
+        // 빈 줄 또는 입력의 끝에서, 변경이 있었던 묶음을 마친다.
+        if (eventCount == 0)
+        {
+            continue;
+        }
+        batchNumber++;
+
+        // 같은 위치는 처음 기록한 값(묶음 전 값)만 남기고, 현재 값과 다른 위치를 출력한다.
+        std::stable_sort(touched.begin(), touched.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        long long int changedCount = 0;
+        for (unsigned long long int i = 0; i < touched.size(); i++)
+        {
+            if (i > 0 && touched[i].first == touched[i - 1].first)
+            {
+                continue;
+            }
+
+            std::complex<long double> value = yMatrix.getMatrix(touched[i].first.first, touched[i].first.second);
+            if (value == touched[i].second)
+            {
+                continue;
+            }
+
+            writer.writeInt(batchNumber);
+            writer.writeChar(',');
+            writer.writeInt(touched[i].first.first);
+            writer.writeChar(',');
+            writer.writeInt(touched[i].first.second);
+            writer.writeChar(',');
+            writer.writeReal(value.real());
+            writer.writeChar(',');
+            writer.writeReal(value.imag());
+            writer.writeChar('\n');
+            changedCount++;
+        }
+        writer.flush();
+
+        std::cerr << std::fixed << std::setprecision(3) << "Batch: " << batchNumber << ", Events: " << eventCount << ", Changed: " << changedCount
+            << ", Nonzeros: " << yMatrix.nonzeroCount() << ", Latency: " << totalTime / eventCount << " us (Max: " << maxTime << " us)" << std::endl;
+
+        touched.clear();
+        eventCount = 0;
+        totalTime = 0;
+        maxTime = 0;
+    }
+
+    return true;
+}
+
+#endif // Y_MATRIX_STREAM_HPP
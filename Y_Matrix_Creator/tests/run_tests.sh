@@ -0,0 +1,67 @@
+#!/bin/sh
+# Y_Matrix_Creator 회귀 테스트
+#
+# y_matrix_core의 source(main이 없는 *.cpp)와 Y_Matrix_Creator.cpp, unit_tests.cpp를 compile한 뒤, tests/ 아래의 각 directory에 있는 cmd를 실행하여
+# 표준 출력과 종료 코드를 expected.txt와 비교한다. (표준 오류의 시간 측정값은 비교하지 않는다.)
+# cmd는 해당 directory에서 sh로 실행되며, $Y는 compile한 실행 파일이다.
+#
+# 사용법: tests/run_tests.sh [--update]   (--update: 실제 출력으로 expected.txt를 다시 만든다.)
+# 환경 변수: CXX(기본값 g++), CXXFLAGS(기본값 -std=c++20 -O2 -ffp-contract=off)
+#            Y(이미 build한 실행 파일, 주어진 경우 compile과 단위 테스트를 하지 않는다. CMake의 regression 테스트가 사용한다.)
+
+TEST_DIR=$(cd "$(dirname "$0")" && pwd)
+SOURCE_DIR=$(cd "$TEST_DIR/.." && pwd)
+BUILD_DIR=$(mktemp -d)
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20 -O2 -ffp-contract=off"}
+trap 'rm -rf "$BUILD_DIR"' EXIT
+
+failed=0
+passed=0
+
+if [ -z "$Y" ]; then
+    # library source는 한 번만 compile하여 실행 파일과 단위 테스트에 함께 link한다.
+    objects=""
+    for source in "$SOURCE_DIR"/*.cpp; do
+        [ "$(basename "$source")" = "Y_Matrix_Creator.cpp" ] && continue
+        object="$BUILD_DIR/$(basename "$source" .cpp).o"
+        $CXX $CXXFLAGS -c "$source" -o "$object" || exit 1
+        objects="$objects $object"
+    done
+    $CXX $CXXFLAGS "$SOURCE_DIR/Y_Matrix_Creator.cpp" $objects -o "$BUILD_DIR/y" -lpthread || exit 1
+    Y="$BUILD_DIR/y"
+
+    # 단위 테스트
+    if [ -f "$TEST_DIR/unit_tests.cpp" ]; then
+        $CXX $CXXFLAGS "$TEST_DIR/unit_tests.cpp" $objects -o "$BUILD_DIR/unit_tests" -lpthread || exit 1
+        if "$BUILD_DIR/unit_tests"; then
+            passed=$((passed + 1))
+        else
+            echo "FAIL: unit_tests"
+            failed=$((failed + 1))
+        fi
+    fi
+fi
+export Y
+
+# 실행 결과 비교
+for case_dir in "$TEST_DIR"/*/; do
+    [ -f "$case_dir/cmd" ] || continue
+    name=$(basename "$case_dir")
+    actual="$BUILD_DIR/$name.out"
+    (cd "$case_dir" && OUT="$BUILD_DIR/$name" && export OUT && sh ./cmd > "$actual" 2>/dev/null; echo "exit=$?" >> "$actual")
+
+    if [ "$1" = "--update" ]; then
+        cp "$actual" "$case_dir/expected.txt"
+        passed=$((passed + 1))
+    elif cmp -s "$actual" "$case_dir/expected.txt"; then
+        passed=$((passed + 1))
+    else
+        echo "FAIL: $name"
+        diff "$case_dir/expected.txt" "$actual" | head -20
+        failed=$((failed + 1))
+    fi
+done
+
+echo "Passed: $passed, Failed: $failed"
+[ "$failed" -eq 0 ]
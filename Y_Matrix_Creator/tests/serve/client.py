@@ -0,0 +1,98 @@
+# Y_Matrix_Creator --serve 통신 형식 테스트 client
+#
+# 사용법: python3 client.py (socket 경로)
+# 각 요청의 status와 응답 payload를 출력한다.
+import socket
+import struct
+import sys
+
+SERVER_GET, SERVER_ROW, SERVER_ADD, SERVER_REMOVE, SERVER_EXPORT, SERVER_INFO = 1, 2, 3, 4, 5, 6
+
+
+def call(sock, opcode, payload=b''):
+    sock.sendall(struct.pack('<II', opcode, len(payload)) + payload)
+    header = b''
+    while len(header) < 8:
+        chunk = sock.recv(8 - len(header))
+        if not chunk:
+            raise RuntimeError('connection closed')
+        header += chunk
+    status, length = struct.unpack('<II', header)
+    data = b''
+    while len(data) < length:
+        chunk = sock.recv(length - len(data))
+        if not chunk:
+            raise RuntimeError('connection closed')
+        data += chunk
+    return status, data
+
+
+def branch(node1, node2, R, L, C):
+    return struct.pack('<qqddd', node1, node2, R, L, C)
+
+
+def values(data, form):
+    size = struct.calcsize(form)
+    return ' '.join('(' + ','.join('%.6g' % v for v in struct.unpack(form, data[i:i + size])) + ')' for i in range(0, len(data), size))
+
+
+def info(sock):
+    status, data = call(sock, SERVER_INFO)
+    print('info', status, struct.unpack('<QQQ', data))
+
+
+def get(sock, *nodes):
+    status, data = call(sock, SERVER_GET, struct.pack('<%dq' % len(nodes), *nodes))
+    print('get', status, values(data, '<dd'))
+
+
+def write(sock, name, opcode, payload):
+    status, data = call(sock, opcode, payload)
+    print(name, status, struct.unpack('<Q', data)[0] if status == 0 else len(data))
+
+
+sock = socket.socket(socket.AF_UNIX)
+sock.connect(sys.argv[1])
+
+info(sock)
+get(sock, 1, 1, 1, 2, 2, 1, 4, 4, 1, 4)
+status, data = call(sock, SERVER_ROW, struct.pack('<q', 3))
+print('row 3', status, values(data, '<qdd'))
+status, data = call(sock, SERVER_ROW, struct.pack('<q', 9))
+print('row 9', status, len(data))
+status, data = call(sock, SERVER_EXPORT)
+print('export', status, values(data, '<qqdd'))
+
+# 선로 추가와 제거 (제거는 node 순서와 관계없다.)
+write(sock, 'add 2-4', SERVER_ADD, branch(2, 4, 0.01, 0.1, 0.1))
+info(sock)
+get(sock, 2, 4, 4, 4)
+write(sock, 'remove 4-2', SERVER_REMOVE, branch(4, 2, 0.01, 0.1, 0.1))
+info(sock)
+get(sock, 2, 4, 4, 4)
+
+# 없는 선로의 제거: 요청 전체를 반영하지 않으며, version과 값이 바뀌지 않는다.
+write(sock, 'remove missing', SERVER_REMOVE, branch(1, 2, 0.01, 0.1, 0.2) + branch(2, 4, 0.01, 0.1, 0.1))
+write(sock, 'remove other value', SERVER_REMOVE, branch(1, 3, 0.02, 0.2, 0.25))
+info(sock)
+get(sock, 1, 1, 1, 2, 2, 2, 2, 4)
+status, data = call(sock, SERVER_EXPORT)
+print('export', status, values(data, '<qqdd'))
+
+# 같은 선로를 두 번 제거하는 경우, 두 번째는 거부한다.
+write(sock, 'add 1-2', SERVER_ADD, branch(1, 2, 0.01, 0.1, 0.2))
+write(sock, 'remove 1-2', SERVER_REMOVE, branch(1, 2, 0.01, 0.1, 0.2) + branch(2, 1, 0.01, 0.1, 0.2))
+write(sock, 'remove 1-2 again', SERVER_REMOVE, branch(1, 2, 0.01, 0.1, 0.2))
+info(sock)
+
+# 오류 응답
+print('bad length get', call(sock, SERVER_GET, b'123'))
+print('empty get', call(sock, SERVER_GET))
+print('bad length row', call(sock, SERVER_ROW, b'\0' * 16))
+print('bad length add', call(sock, SERVER_ADD, b'\0' * 39))
+print('bad length info', call(sock, SERVER_INFO, b'\0'))
+print('zero branch', call(sock, SERVER_ADD, branch(2, 4, 0.0, 0.0, 0.1)))
+print('nan branch', call(sock, SERVER_ADD, branch(2, 4, float('nan'), 0.1, 0.1)))
+print('unknown opcode', call(sock, 42))
+info(sock)
+sock.close()
@@ -0,0 +1,453 @@
+/* Y_Matrix_Creator 단위 테스트
+*
+* main이 없는 y_matrix_core library와 link하여, Y_Matrix, buildCSR(), Sparse_LU, Branch_Counter의 내부 동작을 확인한다.
+* 실패한 항목을 출력하고, 하나라도 실패한 경우 1을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+#include<iostream>
+#include<string>
+#include<vector>
+#include<complex>
+
+#include "../y_matrix.hpp"
+#include "../sparse_lu.hpp"
+#include "../stream.hpp"
+
+// 실패한 항목의 수
+int failedCount = 0;
+
+/* checkValue() 함수
+*
+* 기능: 두 복소수가 상대 오차 1e-12 안에서 같은지 확인하고, 다른 경우 항목 이름과 두 값을 출력한다.
+* 입력값: name(항목 이름), actual, expected
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void checkValue(const std::string& name, std::complex<long double> actual, std::complex<long double> expected)
+{
+    if (std::abs(actual - expected) > 1e-12L * std::max(1.0L, std::abs(expected)))
+    {
+        std::cout << "FAIL: " << name << " (" << actual << " != " << expected << ")" << std::endl;
+        failedCount++;
+    }
+
+    return;
+}
+
+/* checkTrue() 함수
+*
+* 기능: 조건이 참인지 확인하고, 거짓인 경우 항목 이름을 출력한다.
+* 입력값: name(항목 이름), condition
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void checkTrue(const std::string& name, bool condition)
+{
+    if (!condition)
+    {
+        std::cout << "FAIL: " << name << std::endl;
+        failedCount++;
+    }
+
+    return;
+}
+
+/* transformerBlock() 함수
+*
+* 기능: 변압기의 2x2 어드미턴스 값을 정의대로 계산한다. ([0]은 tap 쪽 node)
+* 입력값: R, X, C, tap, shift(도), block(계산한 값을 저장할 배열)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void transformerBlock(long double R, long double X, long double C, long double tap, long double shift, std::complex<long double> block[2][2])
+{
+    std::complex<long double> seriesY = 1.0L / std::complex<long double>(R, X), chargeY(0, C / 2);
+    std::complex<long double> rotation = std::polar(1.0L, shift * 3.14159265358979323846L / 180);
+
+    block[0][0] = (seriesY + chargeY) / (tap * tap);
+    block[1][1] = seriesY + chargeY;
+    block[0][1] = -seriesY * rotation / tap;
+    block[1][0] = -seriesY * std::conj(rotation) / tap;
+
+    return;
+}
+
+/* homeSlot() 함수
+*
+* 기능: Y_Matrix::hashNode()와 같은 방식으로, 대각 성분 (node, node)가 크기 tableSize인 hashTable에서 처음 확인하는 칸을 구한다.
+* 입력값: node, tableSize(2의 거듭제곱)
+* 출력값: 칸의 위치
+* 최종 수정일: 2026/10/17
+*/
+unsigned long long int homeSlot(long long int node, unsigned long long int tableSize)
+{
+    unsigned long long int key = (unsigned long long int)node * 0x9E3779B97F4A7C15ULL ^ (unsigned long long int)node;
+
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+
+    return key & (tableSize - 1);
+}
+
+/* testHashCollision() 함수
+*
+* 기능: 같은 칸에서 시작하는(충돌하는) 값들을 넣고, 가운데 값과 끝의 칸을 넘어 이어진 값(wrap-around)을 지운 뒤에도
+*       남은 값을 모두 찾을 수 있는지 확인한다. (Backward Shift Deletion) 값은 병렬 소자로 대각 성분에 더하고 빼서 정확히 0으로 만든다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testHashCollision()
+{
+    Y_Matrix<long double, long long int> yMatrix;
+    std::vector<long long int> colliding, other;
+
+    // 처음 hashTable의 크기는 16이며, 8개까지 늘어나지 않는다. 마지막 칸(15)에서 시작하는 node 4개와, 다른 칸에서 시작하는 node 3개를 고른다.
+    for (long long int node = 1; colliding.size() < 4 || other.size() < 3; node++)
+    {
+        if (homeSlot(node, 16) == 15)
+        {
+            if (colliding.size() < 4)
+            {
+                colliding.push_back(node);
+            }
+        }else if (other.size() < 3 && homeSlot(node, 16) <= 2)
+        {
+            other.push_back(node);
+        }
+    }
+
+    std::vector<long long int> node(colliding);
+    node.insert(node.end(), other.begin(), other.end());
+    for (unsigned long long int i = 0; i < node.size(); i++)
+    {
+        yMatrix.addShunt(node[i], 0.1L * (i + 1), -1.0L * (i + 1));
+    }
+    checkTrue("hash collision nonzeros", yMatrix.nonzeroCount() == 7);
+
+    // 충돌한 값 중 두 번째와 마지막 칸(15)에 있는 첫 번째 값을 지운다.
+    yMatrix.subtractShunt(colliding[1], 0.2L, -2.0L);
+    yMatrix.subtractShunt(colliding[0], 0.1L, -1.0L);
+    checkTrue("hash erase nonzeros", yMatrix.nonzeroCount() == 5);
+    for (unsigned long long int i = 0; i < node.size(); i++)
+    {
+        std::complex<long double> expected = (i <= 1) ? std::complex<long double>(0, 0) : std::complex<long double>(0.1L * (i + 1), -1.0L * (i + 1));
+        checkValue("hash erase lookup " + std::to_string(node[i]), yMatrix.getMatrix(node[i], node[i]), expected);
+    }
+
+    // 0이 되어 지운 값을 다시 넣는다.
+    yMatrix.addShunt(colliding[0], 0.5L, 0.5L);
+    yMatrix.addShunt(colliding[1], 0.25L, 0.25L);
+    checkTrue("hash reinsert nonzeros", yMatrix.nonzeroCount() == 7);
+    checkValue("hash reinsert " + std::to_string(colliding[0]), yMatrix.getMatrix(colliding[0], colliding[0]), { 0.5L, 0.5L });
+    checkValue("hash reinsert " + std::to_string(colliding[1]), yMatrix.getMatrix(colliding[1], colliding[1]), { 0.25L, 0.25L });
+    for (unsigned long long int i = 2; i < node.size(); i++)
+    {
+        checkValue("hash reinsert lookup " + std::to_string(node[i]), yMatrix.getMatrix(node[i], node[i]), { 0.1L * (i + 1), -1.0L * (i + 1) });
+    }
+
+    return;
+}
+
+/* testHashGrowth() 함수
+*
+* 기능: hashTable의 크기가 여러 번 늘어나는 동안 넣은 값과, 그 중 절반을 지우고 다시 넣은 값을 모두 찾을 수 있는지 확인한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testHashGrowth()
+{
+    Y_Matrix<long double, long long int> yMatrix;
+    const long long int count = 5000;
+
+    for (long long int node = 1; node <= count; node++)
+    {
+        yMatrix.addShunt(node, node, -node);
+    }
+    checkTrue("hash growth nonzeros", yMatrix.nonzeroCount() == count);
+
+    // 짝수 node를 지운다.
+    for (long long int node = 2; node <= count; node += 2)
+    {
+        yMatrix.subtractShunt(node, node, -node);
+    }
+    checkTrue("hash growth erase nonzeros", yMatrix.nonzeroCount() == count / 2);
+
+    // 없는 값을 찾고, 지운 값 대신 새로운 값을 넣는다.
+    bool isFound = true;
+    for (long long int node = 1; node <= count; node++)
+    {
+        std::complex<long double> expected = node % 2 == 1 ? std::complex<long double>(node, -node) : std::complex<long double>(0, 0);
+        isFound = isFound && yMatrix.getMatrix(node, node) == expected;
+    }
+    checkTrue("hash growth lookup after erase", isFound);
+    for (long long int node = count + 1; node <= count * 2; node++)
+    {
+        yMatrix.addShunt(node, node, -node);
+    }
+    isFound = yMatrix.nonzeroCount() == count / 2 * 3;
+    for (long long int node = 1; node <= count * 2; node++)
+    {
+        std::complex<long double> expected = (node % 2 == 1 || node > count) ? std::complex<long double>(node, -node) : std::complex<long double>(0, 0);
+        isFound = isFound && yMatrix.getMatrix(node, node) == expected;
+    }
+    checkTrue("hash growth lookup after rehash", isFound);
+
+    return;
+}
+
+/* testAsymmetricStorage() 함수
+*
+* 기능: 위상 변위 변압기의 tap 쪽 node 번호가 더 큰 경우((Node2, Node1) 순서), 상삼각 값과 하삼각 값이 각각 올바른 위치에 저장되는지 확인한다.
+*       CSR 형태로 바꾼 뒤에도 같은 값을 읽는지 확인한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testAsymmetricStorage()
+{
+    Y_Matrix<long double, long long int> yMatrix;
+    std::complex<long double> block[2][2];
+
+    // tap 쪽이 node 7, 반대쪽이 node 2
+    yMatrix.addTransformer(7, 2, 0.01L, 0.1L, 0.02L, 1.05L, 30);
+    transformerBlock(0.01L, 0.1L, 0.02L, 1.05L, 30, block);
+
+    checkValue("asymmetric (7,7)", yMatrix.getMatrix(7, 7), block[0][0]);
+    checkValue("asymmetric (2,2)", yMatrix.getMatrix(2, 2), block[1][1]);
+    checkValue("asymmetric (7,2)", yMatrix.getMatrix(7, 2), block[0][1]);
+    checkValue("asymmetric (2,7)", yMatrix.getMatrix(2, 7), block[1][0]);
+
+    Y_Matrix_CSR matrixCSR = yMatrix.freeze();
+    checkValue("asymmetric CSR (7,2)", matrixCSR.getMatrix(7, 2), block[0][1]);
+    checkValue("asymmetric CSR (2,7)", matrixCSR.getMatrix(2, 7), block[1][0]);
+    checkTrue("asymmetric CSR nonzeros", matrixCSR.colIdx.size() == 4);
+
+    return;
+}
+
+/* testUpdateTap() 함수
+*
+* 기능: updateTap()으로 tap 비와 위상 변위를 바꾼 값이 새로운 값으로 처음부터 구성한 값과 같고,
+*       다시 원래 값으로 바꾸면 처음 값으로 돌아오는지 확인한다. (병렬 소자와 선로가 함께 있는 node 포함)
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testUpdateTap()
+{
+    Y_Matrix<long double, long long int> yMatrix, expected;
+    const long long int node[3] = { 1, 2, 3 };
+
+    yMatrix.addMatrixPackage(1, 3, 0.02L, 0.2L, 0.1L);
+    yMatrix.addShunt(2, 0.01L, 0.3L);
+    yMatrix.addTransformer(2, 1, 0.005L, 0.08L, 0.01L, 1.05L, 10);
+
+    expected.addMatrixPackage(1, 3, 0.02L, 0.2L, 0.1L);
+    expected.addShunt(2, 0.01L, 0.3L);
+    expected.addTransformer(2, 1, 0.005L, 0.08L, 0.01L, 0.95L, -5);
+
+    std::complex<long double> original[3][3];
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            original[i][j] = yMatrix.getMatrix(node[i], node[j]);
+        }
+    }
+
+    yMatrix.updateTap(2, 1, 0.005L, 0.08L, 0.01L, 1.05L, 10, 0.95L, -5);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            std::string name = "updateTap (" + std::to_string(node[i]) + "," + std::to_string(node[j]) + ")";
+            checkValue(name, yMatrix.getMatrix(node[i], node[j]), expected.getMatrix(node[i], node[j]));
+        }
+    }
+
+    yMatrix.updateTap(2, 1, 0.005L, 0.08L, 0.01L, 0.95L, -5, 1.05L, 10);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            std::string name = "updateTap round trip (" + std::to_string(node[i]) + "," + std::to_string(node[j]) + ")";
+            checkValue(name, yMatrix.getMatrix(node[i], node[j]), original[i][j]);
+        }
+    }
+
+    return;
+}
+
+/* testBuildCSRLowerMerge() 함수
+*
+* 기능: buildCSR()이 하삼각 값(상삼각 값과의 차이)을 node를 뒤바꾼 상삼각 값에 합치고,
+*       상삼각 값이 없는 하삼각 값도 대칭 구조(상삼각 위치는 0)로 저장하는지 확인한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testBuildCSRLowerMerge()
+{
+    std::vector<Y_Matrix_Val<long double, long long int>> entry = {
+        { 1, 1, 3, -30 }, { 2, 2, 2, -20 }, { 4, 4, 1, -10 },
+        { 1, 2, -1, 10 }, { 2, 1, 0.5L, -0.25L }, // (2,1) = (1,2) + 차이
+        { 4, 1, 0.125L, 2 }, // 상삼각 값이 없는 하삼각 값
+    };
+
+    Y_Matrix_CSR matrixCSR = buildCSR(entry);
+
+    checkTrue("buildCSR rows", matrixCSR.nodeNum == std::vector<long long int>({ 1, 2, 4 }));
+    checkTrue("buildCSR nonzeros", matrixCSR.colIdx.size() == 7);
+    checkValue("buildCSR (1,2)", matrixCSR.getMatrix(1, 2), { -1, 10 });
+    checkValue("buildCSR (2,1)", matrixCSR.getMatrix(2, 1), { -0.5L, 9.75L });
+    checkValue("buildCSR (1,4)", matrixCSR.getMatrix(1, 4), { 0, 0 });
+    checkValue("buildCSR (4,1)", matrixCSR.getMatrix(4, 1), { 0.125L, 2 });
+    checkValue("buildCSR (4,4)", matrixCSR.getMatrix(4, 4), { 1, -10 });
+    checkTrue("buildCSR (1,4) stored", matrixCSR.findEntry(1, 4) != -1);
+
+    // 각 행의 열 위치는 오름차순이어야 한다.
+    for (unsigned long long int row = 0; row < matrixCSR.nodeNum.size(); row++)
+    {
+        for (long long int i = matrixCSR.rowPtr[row] + 1; i < matrixCSR.rowPtr[row + 1]; i++)
+        {
+            checkTrue("buildCSR column order", matrixCSR.colIdx[i - 1] < matrixCSR.colIdx[i]);
+        }
+    }
+
+    return;
+}
+
+/* testSparseLUSolve() 함수
+*
+* 기능: 고리 모양(fill-in이 생기는) 계통에 위상 변위 변압기와 병렬 소자를 더한 Y-Matrix에 대해, 정한 전압 V로 I = Y V를 구한 뒤
+*       factorMatrix()와 solve()로 Y V = I를 풀어 처음의 V가 나오는지 확인한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testSparseLUSolve()
+{
+    Y_Matrix<long double, long long int> yMatrix;
+
+    for (long long int node = 1; node <= 6; node++)
+    {
+        yMatrix.addMatrixPackage(node, node % 6 + 1, 0.01L * node, 0.1L + 0.02L * node, 0.02L);
+        yMatrix.addShunt(node, 0.05L, -0.2L);
+    }
+    yMatrix.addMatrixPackage(1, 4, 0.02L, 0.15L, 0.01L);
+    yMatrix.addTransformer(5, 2, 0.005L, 0.08L, 0, 1.05L, 30);
+    Y_Matrix_CSR matrixCSR = yMatrix.freeze();
+
+    // I = Y V
+    long long int nodeCount = matrixCSR.nodeNum.size();
+    std::vector<std::complex<double>> voltage(nodeCount), current(nodeCount, 0);
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        voltage[row] = std::complex<double>(1 - 0.02 * row, -0.05 * row);
+    }
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+        {
+            current[row] += std::complex<double>((double)matrixCSR.G[cursor], (double)matrixCSR.jB[cursor]) * voltage[matrixCSR.colIdx[cursor]];
+        }
+    }
+
+    Sparse_LU<std::complex<double>> matrixLU;
+    double analyzeTime, factorTime;
+    std::string errorMessage;
+    checkTrue("LU factor", factorMatrix(matrixCSR, matrixLU, analyzeTime, factorTime, errorMessage));
+    checkTrue("LU fill-in", matrixLU.factorNonzeros() > (long long int)matrixCSR.colIdx.size());
+    matrixLU.solve(current);
+    for (long long int row = 0; row < nodeCount; row++)
+    {
+        checkValue("LU solve V" + std::to_string(matrixCSR.nodeNum[row]), current[row], voltage[row]);
+    }
+
+    return;
+}
+
+/* testSparseLUPivot() 함수
+*
+* 기능: 접지되지 않은(대지로의 병렬 성분이 없는) 계통처럼 특이한 Y-Matrix는, 반올림 오차로 pivot이 0이 아니더라도
+*       factorMatrix()가 실패하고 pivot이 너무 작은 node를 알려주는지 확인한다.
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testSparseLUPivot()
+{
+    Y_Matrix<long double, long long int> yMatrix;
+
+    yMatrix.addMatrixPackage(1, 2, 0.01L, 0.1L, 0);
+    yMatrix.addMatrixPackage(2, 3, 0.03L, 0.7L, 0);
+    yMatrix.addMatrixPackage(3, 1, 0.07L, 0.3L, 0);
+    Y_Matrix_CSR matrixCSR = yMatrix.freeze();
+
+    Sparse_LU<std::complex<double>> matrixLU;
+    double analyzeTime, factorTime;
+    std::string errorMessage;
+    checkTrue("LU singular", !factorMatrix(matrixCSR, matrixLU, analyzeTime, factorTime, errorMessage));
+    checkTrue("LU singular pivot", matrixLU.failedPivot() != -1);
+    checkTrue("LU singular message", errorMessage.rfind("Singular Y-Matrix - Pivot Too Small at Node ", 0) == 0);
+
+    return;
+}
+
+/* testBranchCounter() 함수
+*
+* 기능: Branch_Counter가 node 순서와 관계없이 같은 선로를 세고, 없는 선로의 제거는 거부하며 수를 바꾸지 않는지 확인한다.
+*       복사본의 증감은 원본에 영향을 주지 않아야 한다. (변형 계통과 server가 사용하는 방식)
+* 입력값 없음
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void testBranchCounter()
+{
+    std::vector<Branch_Val> branch = { { 1, 2, 0.01L, 0.1L, 0.2L }, { 2, 3, 0.02L, 0.1L, 0.3L }, { 2, 1, 0.01L, 0.1L, 0.2L } };
+    Branch_Counter branchCounter(branch);
+
+    // 기본 계통에 같은 선로가 2개 있으므로, 두 번까지 제거할 수 있다.
+    checkTrue("counter remove base", branchCounter.removeBranch({ 2, 1, 0.01L, 0.1L, 0.2L }));
+    checkTrue("counter remove base again", branchCounter.removeBranch({ 1, 2, 0.01L, 0.1L, 0.2L }));
+    checkTrue("counter remove exhausted", !branchCounter.removeBranch({ 1, 2, 0.01L, 0.1L, 0.2L }));
+
+    // 값이 다른 선로와 없는 선로는 제거할 수 없다.
+    checkTrue("counter remove other value", !branchCounter.removeBranch({ 2, 3, 0.02L, 0.1L, 0.25L }));
+    checkTrue("counter remove missing", !branchCounter.removeBranch({ 3, 4, 0.01L, 0.1L, 0 }));
+
+    // 추가한 선로는 제거할 수 있으며, 복사본에서 제거해도 원본에는 남는다.
+    branchCounter.addBranch({ 4, 3, 0.01L, 0.1L, 0 });
+    Branch_Counter copiedCounter(branchCounter);
+    checkTrue("counter remove copy", copiedCounter.removeBranch({ 3, 4, 0.01L, 0.1L, 0 }));
+    checkTrue("counter remove copy again", !copiedCounter.removeBranch({ 3, 4, 0.01L, 0.1L, 0 }));
+    checkTrue("counter remove original", branchCounter.removeBranch({ 3, 4, 0.01L, 0.1L, 0 }));
+    checkTrue("counter remove base after", branchCounter.removeBranch({ 3, 2, 0.02L, 0.1L, 0.3L }));
+
+    return;
+}
+
+int main()
+{
+    testHashCollision();
+    testHashGrowth();
+    testAsymmetricStorage();
+    testUpdateTap();
+    testBuildCSRLowerMerge();
+    testSparseLUSolve();
+    testSparseLUPivot();
+    testBranchCounter();
+
+    if (failedCount > 0)
+    {
+        std::cout << "Unit Tests Failed: " << failedCount << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,350 @@
+﻿#include<iostream>
+#include<map>
+
+#include "variants.hpp"
+#include "stream.hpp"
+
+/* Y_Matrix_Variant의 생성자
+*
+* 기능: 기본 계통에서 바로 갈라지는 변형 계통을 만든다.
+* 최종 수정일: 2026/10/17
+*/
+Y_Matrix_Variant::Y_Matrix_Variant(std::shared_ptr<const Y_Matrix_CSR> baseMatrix)
+{
+    base = std::move(baseMatrix);
+
+    return;
+}
+
+/* Y_Matrix_Variant의 생성자
+*
+* 기능: 다른 변형 계통에서 갈라지는 변형 계통을 만든다. 부모의 차이는 복사하지 않고 공유한다.
+* 최종 수정일: 2026/10/17
+*/
+Y_Matrix_Variant::Y_Matrix_Variant(std::shared_ptr<const Y_Matrix_Variant> parentVariant)
+{
+    base = parentVariant->base;
+    parent = std::move(parentVariant);
+
+    return;
+}
+
+/* Y_Matrix_Variant::addMatrixPackage() 함수
+*
+* 기능: 변형 계통에 선로를 추가한다. (차이에만 더한다.)
+* 입력값: Node1, Node2, R, L, C값
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Y_Matrix_Variant::addMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C)
+{
+    delta.addMatrixPackage(Node1, Node2, R, L, C);
+
+    return;
+}
+
+/* Y_Matrix_Variant::subtractMatrixPackage() 함수
+*
+* 기능: 변형 계통에서 선로를 제거한다. (차이에서만 뺀다.)
+* 입력값: Node1, Node2, R, L, C값
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Y_Matrix_Variant::subtractMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C)
+{
+    delta.subtractMatrixPackage(Node1, Node2, R, L, C);
+
+    return;
+}
+
+/* Y_Matrix_Variant::getMatrix() 함수
+*
+* 기능: 변형 계통의 특정 node의 값을 읽는다. 자신부터 부모 순서로 차이를 더한 뒤, 기본 계통의 값을 더한다.
+* 입력값: Node1, Node2
+* 출력값: 해당 node의 어드미턴스(실수값 G, 허수값 jB)
+* 최종 수정일: 2026/10/17
+*/
+std::complex<long double> Y_Matrix_Variant::getMatrix(long long int Node1, long long int Node2) const
+{
+    std::complex<long double> value = 0;
+
+    for (const Y_Matrix_Variant* variant = this; variant != NULL; variant = variant->parent.get())
+    {
+        value += variant->delta.getMatrix(Node1, Node2);
+    }
+
+    return value + base->getMatrix(Node1, Node2);
+}
+
+/* Y_Matrix_Variant::changedEntry() 함수
+*
+* 기능: 자신과 부모들이 바꾼 위치 중, 값이 기본 계통과 다른 위치(node1 <= node2)를 오름차순으로 구한다.
+* 입력값 없음
+* 출력값: 바뀐 위치의 목록
+* 최종 수정일: 2026/10/17
+*/
+std::vector<std::pair<long long int, long long int>> Y_Matrix_Variant::changedEntry() const
+{
+    std::vector<std::pair<long long int, long long int>> entry;
+
+    for (const Y_Matrix_Variant* variant = this; variant != NULL; variant = variant->parent.get())
+    {
+        Y_Matrix_CSR deltaCSR = variant->delta.freeze();
+        for (unsigned long long int row = 0; row < deltaCSR.nodeNum.size(); row++)
+        {
+            for (long long int cursor = deltaCSR.rowPtr[row]; cursor < deltaCSR.rowPtr[row + 1]; cursor++)
+            {
+                if (deltaCSR.colIdx[cursor] >= (long long int)row)
+                {
+                    entry.push_back({ deltaCSR.nodeNum[row], deltaCSR.nodeNum[deltaCSR.colIdx[cursor]] });
+                }
+            }
+        }
+    }
+    std::sort(entry.begin(), entry.end());
+    entry.erase(std::unique(entry.begin(), entry.end()), entry.end());
+
+    // 더하고 뺀 결과 기본 계통과 값이 같아진 위치는 제외한다.
+    entry.erase(std::remove_if(entry.begin(), entry.end(), [this](const std::pair<long long int, long long int>& node) {
+        return getMatrix(node.first, node.second) == base->getMatrix(node.first, node.second);
+    }), entry.end());
+
+    return entry;
+}
+
+/* Y_Matrix_Variant::overlayCount() 함수
+*
+* 기능: 부모와의 차이로 저장한 값의 수를 출력한다.
+* 입력값 없음
+* 출력값: 차이로 저장한 값의 수
+* 최종 수정일: 2026/10/17
+*/
+long long int Y_Matrix_Variant::overlayCount() const
+{
+    return delta.nonzeroCount();
+}
+
+/* Y_Matrix_Variant::memoryUsage() 함수
+*
+* 기능: 부모와의 차이를 저장하는 데 사용하는 memory의 크기를 출력한다. (공유하는 기본 계통과 부모는 포함하지 않는다.)
+* 입력값 없음
+* 출력값: 사용하는 memory의 크기(Byte)
+* 최종 수정일: 2026/10/17
+*/
+unsigned long long int Y_Matrix_Variant::memoryUsage() const
+{
+    return delta.memoryUsage();
+}
+
+/* Y_Matrix_Variant::materialize() 함수
+*
+* 기능: 변형 계통의 전체 Y-Matrix를 CSR 형태로 만든다.
+*       자신부터 부모 순서로 차이를 모은 뒤 기본 계통의 값을 모아, 같은 위치의 값을 모은 순서대로 더하므로 getMatrix()와 같은 값을 얻는다.
+* 입력값 없음
+* 출력값: CSR 형태의 Y-Matrix
+* 최종 수정일: 2026/10/17
+*/
+Y_Matrix_CSR Y_Matrix_Variant::materialize() const
+{
+    std::vector<Y_Matrix_Val<>> entry, reducedEntry;
+
+    // 주어진 CSR 형태의 Y-Matrix에서 node1 <= node2인 값과, 상삼각 값과 다른 하삼각 값(위상 변위 변압기)의 차이를 모은다.
+    auto appendUpper = [&entry](const Y_Matrix_CSR& matrixCSR)
+    {
+        for (unsigned long long int row = 0; row < matrixCSR.nodeNum.size(); row++)
+        {
+            for (long long int cursor = matrixCSR.rowPtr[row]; cursor < matrixCSR.rowPtr[row + 1]; cursor++)
+            {
+                long long int col = matrixCSR.colIdx[cursor];
+                if (col >= (long long int)row)
+                {
+                    entry.push_back({ matrixCSR.nodeNum[row], matrixCSR.nodeNum[col], matrixCSR.G[cursor], matrixCSR.jB[cursor] });
+                    continue;
+                }
+
+                long long int upper = matrixCSR.findEntry(matrixCSR.nodeNum[col], matrixCSR.nodeNum[row]);
+                if (upper != -1 && (matrixCSR.G[cursor] != matrixCSR.G[upper] || matrixCSR.jB[cursor] != matrixCSR.jB[upper]))
+                {
+                    entry.push_back({ matrixCSR.nodeNum[row], matrixCSR.nodeNum[col], matrixCSR.G[cursor] - matrixCSR.G[upper], matrixCSR.jB[cursor] - matrixCSR.jB[upper] });
+                }
+            }
+        }
+    };
+
+    for (const Y_Matrix_Variant* variant = this; variant != NULL; variant = variant->parent.get())
+    {
+        appendUpper(variant->delta.freeze());
+    }
+    appendUpper(*base);
+
+    // 같은 위치의 값을 모은 순서대로 더하고, 0이 된 값은 제거한다.
+    std::stable_sort(entry.begin(), entry.end(), [](const Y_Matrix_Val<>& a, const Y_Matrix_Val<>& b) {
+        return a.node1 != b.node1 ? a.node1 < b.node1 : a.node2 < b.node2;
+    });
+    reducedEntry.reserve(entry.size() * 2);
+    for (unsigned long long int i = 0; i < entry.size(); i++)
+    {
+        if (!reducedEntry.empty() && i > 0 && entry[i].node1 == entry[i - 1].node1 && entry[i].node2 == entry[i - 1].node2)
+        {
+            reducedEntry.back().G += entry[i].G;
+            reducedEntry.back().jB += entry[i].jB;
+        }else{
+            if (!reducedEntry.empty() && reducedEntry.back().G == 0 && reducedEntry.back().jB == 0)
+            {
+                reducedEntry.pop_back();
+            }
+            reducedEntry.push_back(entry[i]);
+        }
+    }
+    if (!reducedEntry.empty() && reducedEntry.back().G == 0 && reducedEntry.back().jB == 0)
+    {
+        reducedEntry.pop_back();
+    }
+
+    return buildCSR(reducedEntry);
+}
+
+/* readVariantFile() 함수
+*
+* 기능: 변형 계통 파일을 읽어, 각 변형 계통을 기본 계통(또는 앞에서 정의한 변형 계통)에서 갈라 차이를 적용한다.
+*       [(이름)] 또는 [(이름) : (부모 이름)] 줄로 변형 계통을 시작하며, 이어지는 +/- 줄(변경 기록 파일 양식)을 해당 변형 계통에 적용한다.
+*       각 변형 계통의 선로 수는 부모(또는 기본 계통)의 Branch_Counter를 이어받아 관리하며, 해당 변형 계통에 없는 선로를 제거하는 줄은 오류로 처리한다.
+* 입력값: filePath, base(기본 계통의 Y-Matrix), branch(기본 계통의 선로), name(각 변형 계통의 이름), variant(각 변형 계통)
+* 출력값: 성공 여부
+* 최종 수정일: 2026/10/17
+*/
+bool readVariantFile(const std::string& filePath, std::shared_ptr<const Y_Matrix_CSR> base, const std::vector<Branch_Val>& branch, std::vector<std::string>& name, std::vector<std::shared_ptr<Y_Matrix_Variant>>& variant)
+{
+    FILE* variantFile = fopen(filePath.c_str(), "rb");
+    std::string line, errorMessage;
+    long long int lineNumber = 0;
+    Branch_Val change;
+    bool isAdd, isSucceeded = true;
+    const Branch_Counter baseCounter(branch);
+    std::vector<Branch_Counter> branchCounter; // 각 변형 계통에 있는 선로의 수
+
+    // 앞뒤의 빈칸을 뺀다.
+    auto trimText = [](const std::string& text)
+    {
+        unsigned long long int first = text.find_first_not_of(" \t");
+        return first == std::string::npos ? std::string() : text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    };
+
+    if (variantFile == NULL)
+    {
+        std::cout << "Variant File Not Found" << std::endl;
+        return false;
+    }
+
+    while (isSucceeded && readStreamLine(variantFile, line))
+    {
+        lineNumber++;
+
+        // 빈 줄은 무시한다.
+        line = trimText(line);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        if (line[0] == '[')
+        {
+            // 변형 계통의 이름과 부모의 이름을 읽는다.
+            std::string header = line.substr(1, line.size() - 2);
+            unsigned long long int separator = header.find(':');
+            std::string variantName = trimText(header.substr(0, separator));
+            std::string parentName = separator == std::string::npos ? "" : trimText(header.substr(separator + 1));
+
+            if (line.back() != ']' || variantName.empty())
+            {
+                errorMessage = "Invalid Variant Header";
+                isSucceeded = false;
+                break;
+            }
+            if (std::find(name.begin(), name.end(), variantName) != name.end())
+            {
+                errorMessage = "Duplicate Variant Name";
+                isSucceeded = false;
+                break;
+            }
+
+            if (parentName.empty())
+            {
+                variant.push_back(std::make_shared<Y_Matrix_Variant>(base));
+                branchCounter.push_back(baseCounter);
+            }else{
+                auto parentLocation = std::find(name.begin(), name.end(), parentName);
+                if (parentLocation == name.end())
+                {
+                    errorMessage = "Unknown Parent Variant";
+                    isSucceeded = false;
+                    break;
+                }
+                variant.push_back(std::make_shared<Y_Matrix_Variant>(std::shared_ptr<const Y_Matrix_Variant>(variant[parentLocation - name.begin()])));
+                branchCounter.push_back(branchCounter[parentLocation - name.begin()]);
+            }
+            name.push_back(variantName);
+            continue;
+        }
+
+        if (variant.empty())
+        {
+            errorMessage = "Record Before Variant Header";
+            isSucceeded = false;
+        }else if (!parseChangeRecord(line, change, isAdd, errorMessage))
+        {
+            isSucceeded = false;
+        }else if (isAdd)
+        {
+            branchCounter.back().addBranch(change);
+            variant.back()->addMatrixPackage(change.node1, change.node2, change.R, change.L, change.C);
+        }else if (!branchCounter.back().removeBranch(change))
+        {
+            errorMessage = "Branch Not Found";
+            isSucceeded = false;
+        }else{
+            variant.back()->subtractMatrixPackage(change.node1, change.node2, change.R, change.L, change.C);
+        }
+    }
+    fclose(variantFile);
+
+    if (!isSucceeded)
+    {
+        std::cout << "Invalid Variant File - Line " << lineNumber << ": " << errorMessage << " (" << line << ")" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/* writeVariants() 함수
+*
+* 기능: 각 변형 계통에서 기본 계통과 달라진 위치(node1 <= node2)의 값을 variant,node1,node2,G,jB 형식으로 출력한다. (제거된 값은 0)
+* 입력값: name, variant, writer
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void writeVariants(const std::vector<std::string>& name, const std::vector<std::shared_ptr<Y_Matrix_Variant>>& variant, Output_Writer& writer)
+{
+    writer.writeText("variant,node1,node2,G,jB\n");
+    for (unsigned long long int i = 0; i < variant.size(); i++)
+    {
+        std::vector<std::pair<long long int, long long int>> entry = variant[i]->changedEntry();
+        for (const std::pair<long long int, long long int>& node : entry)
+        {
+            std::complex<long double> value = variant[i]->getMatrix(node.first, node.second);
+            writer.writeText(name[i].c_str());
+            writer.writeChar(',');
+            writer.writeInt(node.first);
+            writer.writeChar(',');
+            writer.writeInt(node.second);
+            writer.writeChar(',');
+            writer.writeReal(value.real());
+            writer.writeChar(',');
+            writer.writeReal(value.imag());
+            writer.writeChar('\n');
+        }
+    }
+
+    return;
+}
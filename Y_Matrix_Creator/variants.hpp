@@ -0,0 +1,55 @@
+﻿/* variants.hpp
+*
+* 기본 계통을 공유하고 차이만을 저장하는 변형 계통(Y_Matrix_Variant 클래스, --variants 옵션)
+*/
+#ifndef Y_MATRIX_VARIANTS_HPP
+#define Y_MATRIX_VARIANTS_HPP
+
+#include<vector>
+#include<string>
+#include<memory>
+
+#include "io.hpp"
+
+/* Y_Matrix_Variant 클래스
+*
+* 기능: 기본 계통의 Y-Matrix(변경되지 않는 CSR 형태)를 여러 변형 계통이 공유하고, 각 변형 계통은 기본 계통(또는 부모 변형 계통)과의 차이만을 저장한다.
+*       차이는 Y_Matrix에 더하고 빼므로, 0이 된 값은 저장하지 않으며 memory는 변형 계통의 수가 아닌 바뀐 값의 수만큼만 사용한다.
+*       getMatrix()는 자신부터 부모 순서로 차이를 더한 뒤 기본 계통의 값을 더하며, materialize()는 같은 순서로 더한 전체 Y-Matrix를 CSR 형태로 만든다.
+*       다른 변형 계통의 부모가 된 변형 계통은 수정하지 않아야 한다. (자식이 부모의 차이를 복사하지 않고 공유한다.)
+* 최종 수정일: 2026/10/17
+*/
+class Y_Matrix_Variant{
+private:
+    // 공유하는 기본 계통의 Y-Matrix와, 부모 변형 계통(없는 경우 NULL)
+    std::shared_ptr<const Y_Matrix_CSR> base;
+    std::shared_ptr<const Y_Matrix_Variant> parent;
+
+    // 부모(또는 기본 계통)와의 차이
+    Y_Matrix<long double, long long int> delta;
+
+public:
+Y_Matrix_Variant(std::shared_ptr<const Y_Matrix_CSR> baseMatrix);
+Y_Matrix_Variant(std::shared_ptr<const Y_Matrix_Variant> parentVariant);
+
+void addMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C);
+
+void subtractMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C);
+
+std::complex<long double> getMatrix(long long int Node1, long long int Node2) const;
+
+std::vector<std::pair<long long int, long long int>> changedEntry() const;
+
+long long int overlayCount() const;
+
+unsigned long long int memoryUsage() const;
+
+Y_Matrix_CSR materialize() const;
+
+};
+
+bool readVariantFile(const std::string& filePath, std::shared_ptr<const Y_Matrix_CSR> base, const std::vector<Branch_Val>& branch, std::vector<std::string>& name, std::vector<std::shared_ptr<Y_Matrix_Variant>>& variant);
+
+void writeVariants(const std::vector<std::string>& name, const std::vector<std::shared_ptr<Y_Matrix_Variant>>& variant, Output_Writer& writer);
+
+#endif // Y_MATRIX_VARIANTS_HPP
@@ -0,0 +1,240 @@
+﻿#include "y_matrix.hpp"
+
+#if Y_MATRIX_X86_SIMD
+#include<immintrin.h>
+#endif
+
+#if Y_MATRIX_X86_SIMD
+/* calcAdmittanceAVX2() 함수
+*
+* 기능: AVX2 명령어로 double 4개(float 8개)씩 어드미턴스를 계산한다. 남은 선로는 일반 계산으로 처리한다.
+* 입력값: count, R, X, C, G, B, diagB
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+__attribute__((target("avx2"))) void calcAdmittanceAVX2(unsigned long long int count, const double* R, const double* X, const double* C, double* G, double* B, double* diagB)
+{
+    const __m256d minusOne = _mm256_set1_pd(-1.0), half = _mm256_set1_pd(0.5);
+    unsigned long long int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256d r = _mm256_loadu_pd(R + i), x = _mm256_loadu_pd(X + i), c = _mm256_loadu_pd(C + i);
+        __m256d denominator = _mm256_add_pd(_mm256_mul_pd(r, r), _mm256_mul_pd(x, x));
+        __m256d b = _mm256_div_pd(_mm256_mul_pd(minusOne, x), denominator);
+
+        _mm256_storeu_pd(G + i, _mm256_div_pd(r, denominator));
+        _mm256_storeu_pd(B + i, b);
+        _mm256_storeu_pd(diagB + i, _mm256_add_pd(b, _mm256_mul_pd(c, half)));
+    }
+    calcAdmittanceScalar(count - i, R + i, X + i, C + i, G + i, B + i, diagB + i);
+
+    return;
+}
+
+__attribute__((target("avx2"))) void calcAdmittanceAVX2(unsigned long long int count, const float* R, const float* X, const float* C, float* G, float* B, float* diagB)
+{
+    const __m256 minusOne = _mm256_set1_ps(-1.0f), half = _mm256_set1_ps(0.5f);
+    unsigned long long int i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 r = _mm256_loadu_ps(R + i), x = _mm256_loadu_ps(X + i), c = _mm256_loadu_ps(C + i);
+        __m256 denominator = _mm256_add_ps(_mm256_mul_ps(r, r), _mm256_mul_ps(x, x));
+        __m256 b = _mm256_div_ps(_mm256_mul_ps(minusOne, x), denominator);
+
+        _mm256_storeu_ps(G + i, _mm256_div_ps(r, denominator));
+        _mm256_storeu_ps(B + i, b);
+        _mm256_storeu_ps(diagB + i, _mm256_add_ps(b, _mm256_mul_ps(c, half)));
+    }
+    calcAdmittanceScalar(count - i, R + i, X + i, C + i, G + i, B + i, diagB + i);
+
+    return;
+}
+
+/* calcAdmittanceAVX512() 함수
+*
+* 기능: AVX-512 명령어로 double 8개(float 16개)씩 어드미턴스를 계산한다. 남은 선로는 일반 계산으로 처리한다.
+* 입력값: count, R, X, C, G, B, diagB
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+#define Y_MATRIX_ROUND (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+__attribute__((target("avx512f"))) void calcAdmittanceAVX512(unsigned long long int count, const double* R, const double* X, const double* C, double* G, double* B, double* diagB)
+{
+    const __m512d minusOne = _mm512_set1_pd(-1.0), half = _mm512_set1_pd(0.5);
+    const __mmask8 all = 0xFF;
+    unsigned long long int i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m512d r = _mm512_loadu_pd(R + i), x = _mm512_loadu_pd(X + i), c = _mm512_loadu_pd(C + i);
+        __m512d denominator = _mm512_maskz_add_round_pd(all, _mm512_maskz_mul_round_pd(all, r, r, Y_MATRIX_ROUND), _mm512_maskz_mul_round_pd(all, x, x, Y_MATRIX_ROUND), Y_MATRIX_ROUND);
+        __m512d b = _mm512_maskz_div_round_pd(all, _mm512_maskz_mul_round_pd(all, minusOne, x, Y_MATRIX_ROUND), denominator, Y_MATRIX_ROUND);
+
+        _mm512_storeu_pd(G + i, _mm512_maskz_div_round_pd(all, r, denominator, Y_MATRIX_ROUND));
+        _mm512_storeu_pd(B + i, b);
+        _mm512_storeu_pd(diagB + i, _mm512_maskz_add_round_pd(all, b, _mm512_maskz_mul_round_pd(all, c, half, Y_MATRIX_ROUND), Y_MATRIX_ROUND));
+    }
+    calcAdmittanceScalar(count - i, R + i, X + i, C + i, G + i, B + i, diagB + i);
+
+    return;
+}
+
+__attribute__((target("avx512f"))) void calcAdmittanceAVX512(unsigned long long int count, const float* R, const float* X, const float* C, float* G, float* B, float* diagB)
+{
+    const __m512 minusOne = _mm512_set1_ps(-1.0f), half = _mm512_set1_ps(0.5f);
+    const __mmask16 all = 0xFFFF;
+    unsigned long long int i = 0;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512 r = _mm512_loadu_ps(R + i), x = _mm512_loadu_ps(X + i), c = _mm512_loadu_ps(C + i);
+        __m512 denominator = _mm512_maskz_add_round_ps(all, _mm512_maskz_mul_round_ps(all, r, r, Y_MATRIX_ROUND), _mm512_maskz_mul_round_ps(all, x, x, Y_MATRIX_ROUND), Y_MATRIX_ROUND);
+        __m512 b = _mm512_maskz_div_round_ps(all, _mm512_maskz_mul_round_ps(all, minusOne, x, Y_MATRIX_ROUND), denominator, Y_MATRIX_ROUND);
+
+        _mm512_storeu_ps(G + i, _mm512_maskz_div_round_ps(all, r, denominator, Y_MATRIX_ROUND));
+        _mm512_storeu_ps(B + i, b);
+        _mm512_storeu_ps(diagB + i, _mm512_maskz_add_round_ps(all, b, _mm512_maskz_mul_round_ps(all, c, half, Y_MATRIX_ROUND), Y_MATRIX_ROUND));
+    }
+    calcAdmittanceScalar(count - i, R + i, X + i, C + i, G + i, B + i, diagB + i);
+
+    return;
+}
+#endif
+
+/* admittanceKernel() 함수
+*
+* 기능: 실행 중인 CPU가 지원하는 명령어에 따라, double과 float의 어드미턴스 일괄 계산에 사용할 방식을 고른다. (처음 한 번만 확인한다.)
+* 입력값 없음
+* 출력값: 2(AVX-512), 1(AVX2), 0(일반 계산)
+* 최종 수정일: 2026/10/17
+*/
+int admittanceKernel()
+{
+#if Y_MATRIX_X86_SIMD
+    static const int kernel = __builtin_cpu_supports("avx512f") ? 2 : __builtin_cpu_supports("avx2") ? 1 : 0;
+    return kernel;
+#else
+    return 0;
+#endif
+}
+
+/* admittanceKernelName() 함수
+*
+* 기능: 어드미턴스 일괄 계산에 사용하는 방식의 이름을 읽는다.
+* 입력값 없음
+* 출력값: 방식의 이름
+* 최종 수정일: 2026/10/17
+*/
+const char* admittanceKernelName()
+{
+    const char* kernelName[3] = { "Scalar", "AVX2", "AVX-512" };
+    return kernelName[admittanceKernel()];
+}
+
+/* Y_Matrix_CSR::findRow() 함수
+*
+* 기능: 특정 node의 값이 저장된 행의 위치를 찾는다. (Binary Search)
+* 입력값: Node
+* 출력값: 행의 위치(저장되지 않은 경우, -1 반환)
+* 최종 수정일: 2026/10/17
+*/
+long long int Y_Matrix_CSR::findRow(long long int Node) const
+{
+    auto location = std::lower_bound(nodeNum.begin(), nodeNum.end(), Node);
+    STATS_ADD(STAT_ROW_SEARCH, 1);
+
+    // 해당 node가 저장되지 않은 경우, -1 출력
+    if (location == nodeNum.end() || *location != Node)
+    {
+        return -1;
+    }
+
+    return location - nodeNum.begin();
+}
+
+/* Y_Matrix_CSR::findEntry() 함수
+*
+* 기능: 특정 두 node의 값이 저장된 위치를 찾는다. (Binary Search)
+* 입력값: Node1, Node2
+* 출력값: colIdx, G, jB에서의 위치(저장되지 않은 경우, -1 반환)
+* 최종 수정일: 2026/10/17
+*/
+long long int Y_Matrix_CSR::findEntry(long long int Node1, long long int Node2) const
+{
+    long long int row = findRow(Node1), col = findRow(Node2);
+
+    // 해당 node가 저장되지 않은 경우, -1 출력
+    if (row == -1 || col == -1)
+    {
+        return -1;
+    }
+
+    auto location = std::lower_bound(colIdx.begin() + rowPtr[row], colIdx.begin() + rowPtr[row + 1], col);
+    if (location == colIdx.begin() + rowPtr[row + 1] || *location != col)
+    {
+        return -1;
+    }
+
+    return location - colIdx.begin();
+}
+
+/* Y_Matrix_CSR::getMatrix() 함수
+*
+* 기능: CSR 형태의 Y-Matrix에서 특정 node의 값을 읽어온다. (저장되지 않은 경우, 0 반환)
+*       구성이 끝난 값을 읽기만 하므로, 여러 thread에서 동시에 호출할 수 있다.
+* 입력값: Node1, Node2
+* 출력값: 해당 node의 어드미턴스(실수값 G, 허수값 jB)
+* 최종 수정일: 2026/10/17
+*/
+std::complex<long double> Y_Matrix_CSR::getMatrix(long long int Node1, long long int Node2) const
+{
+    long long int location = findEntry(Node1, Node2);
+
+    if (location == -1)
+    {
+        return 0;
+    }
+
+    return std::complex<long double>(G[location], jB[location]);
+}
+
+/* Y_Matrix_CSR::getMatrix() 함수
+*
+* 기능: CSR 형태의 Y-Matrix에서 여러 node의 값을 한 번에 읽어, 주어진 공간에 차례대로 저장한다.
+*       같은 Node1이 이어지는 경우, 행의 위치를 다시 찾지 않는다.
+* 입력값: node((Node1, Node2)의 목록), matrixVal(어드미턴스를 저장할 공간, node와 길이가 같아야 한다.)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+void Y_Matrix_CSR::getMatrix(std::span<const std::pair<long long int, long long int>> node, std::span<std::complex<long double>> matrixVal) const
+{
+    long long int lastNode = 0, row = -1;
+
+    for (unsigned long long int i = 0; i < node.size(); i++)
+    {
+        // 이전 값과 Node1이 다른 경우에만 행의 위치를 찾는다.
+        if (i == 0 || node[i].first != lastNode)
+        {
+            lastNode = node[i].first;
+            row = findRow(lastNode);
+        }
+
+        long long int col = findRow(node[i].second);
+        matrixVal[i] = 0;
+        if (row == -1 || col == -1)
+        {
+            continue;
+        }
+
+        auto location = std::lower_bound(colIdx.begin() + rowPtr[row], colIdx.begin() + rowPtr[row + 1], col);
+        if (location != colIdx.begin() + rowPtr[row + 1] && *location == col)
+        {
+            matrixVal[i] = std::complex<long double>(G[location - colIdx.begin()], jB[location - colIdx.begin()]);
+        }
+    }
+
+    return;
+}
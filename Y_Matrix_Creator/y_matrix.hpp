@@ -0,0 +1,1378 @@
+﻿/* y_matrix.hpp
+*
+* Y-Matrix의 구성(Y_Matrix 클래스)과 구성이 끝난 Y-Matrix(Y_Matrix_CSR 구조체), 선로와 소자 정보, 선로 어드미턴스 계산
+*/
+#ifndef Y_MATRIX_Y_MATRIX_HPP
+#define Y_MATRIX_Y_MATRIX_HPP
+
+#include<vector>
+#include<complex>
+#include<span>
+#include<utility>
+#include<algorithm>
+#include<thread>
+#include<cstdint>
+#include<cmath>
+#include<type_traits>
+
+#include "stats.hpp"
+
+/* Y_Matrix_Val 구조체
+ *
+ * 인수: node1, node2(연결된 Node), G, jB(어드미턴스의 실수값과 허수값)
+ *       T는 어드미턴스 값의 실수 형식, IndexT는 node 번호의 정수 형식이다.
+ * 최종 수정일: 2026/10/17
+*/
+template <typename T = long double, typename IndexT = long long int>
+struct Y_Matrix_Val
+{
+    IndexT node1, node2;
+    T G, jB;
+};
+
+/* Branch_Val 구조체
+ *
+ * 기능: 입력 파일의 한 줄(선로 1개)을 저장한다.
+ * 인수: node1, node2(연결된 Node), R, L, C(선로 저항, 선로 Inductance, 선로와 지면 사이의 Capacitance)
+ * 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    long long int node1, node2;
+    long double R, L, C;
+}Branch_Val;
+
+/* Device_Val 구조체
+ *
+ * 기능: 입력 파일의 변압기 또는 병렬 소자 한 줄을 저장한다.
+ * 인수: type(DEVICE_TRANSFORMER, DEVICE_SHUNT), node1, node2(변압기의 tap 쪽 node와 반대쪽 node, 병렬 소자는 node1만 사용),
+ *       R, L, C(변압기의 직렬 저항, 리액턴스, 충전 Capacitance), tap, shift(변압기의 tap 비와 위상 변위(도)), G, B(병렬 소자의 어드미턴스)
+ * 최종 수정일: 2026/10/17
+*/
+typedef struct
+{
+    int type;
+    long long int node1, node2;
+    long double R, L, C, tap, shift, G, B;
+}Device_Val;
+
+// 소자의 종류
+const int DEVICE_TRANSFORMER = 1;
+const int DEVICE_SHUNT = 2;
+
+/* Y_Matrix_CSR 구조체
+ *
+ * 기능: 구성이 끝난 Y-Matrix를 CSR(Compressed Sparse Row) 형태로 저장한다. 상삼각, 하삼각 부분을 모두 저장한다.
+ * 인수: nodeNum(각 행의 node 번호, 오름차순), rowPtr(각 행의 값이 시작하는 위치, 길이는 행의 수 + 1),
+ *       colIdx(각 값의 열 위치, 행 안에서 오름차순), G, jB(어드미턴스의 실수값과 허수값)
+ * 최종 수정일: 2026/10/17
+*/
+struct Y_Matrix_CSR
+{
+    std::vector<long long int> nodeNum, rowPtr, colIdx;
+    std::vector<long double> G, jB;
+
+    long long int findRow(long long int Node) const;
+
+    long long int findEntry(long long int Node1, long long int Node2) const;
+
+    std::complex<long double> getMatrix(long long int Node1, long long int Node2) const;
+
+    void getMatrix(std::span<const std::pair<long long int, long long int>> node, std::span<std::complex<long double>> matrixVal) const;
+};
+
+/* RealValCalc() 함수
+*
+* 기능: 주어진 저항성분 R+jX에 대한 어드미턴스 실수부를 구한다. (T: 계산에 사용할 실수 형식)
+* 입력값: R, X
+* 출력값: 어드미턴스 실수부
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+inline T RealValCalc(T R, T X)
+{
+    return R / (R * R + X * X);
+}
+
+/* ImagValCalc() 함수
+*
+* 기능: 주어진 저항성분 R+jX에 대한 어드미턴스 허수부를 구한다. (T: 계산에 사용할 실수 형식)
+* 입력값: R, X
+* 출력값: 어드미턴스 허수부
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+inline T ImagValCalc(T R, T X)
+{
+    return (-1) * X / (R * R + X * X);
+}
+
+/* 어드미턴스 일괄 계산
+*
+* 여러 선로의 R, X, C 배열로부터 직렬 어드미턴스(G + jB)와 대각 성분에 더해지는 허수값(B + C/2)을 한 번에 계산한다.
+* 선로마다 분모(R*R + X*X)를 한 번만 계산하며, double과 float는 실행 중인 CPU에 따라 AVX-512, AVX2 또는 일반 계산을 선택한다.
+* 모든 방식이 같은 순서로 곱셈, 덧셈, 나눗셈을 하므로, 선택된 방식과 관계없이 결과가 bit 단위로 같다.
+* (컴파일러가 곱셈과 덧셈을 FMA로 합치지 않도록, AVX2 함수는 FMA 없이 컴파일하고 AVX-512 함수는 반올림 방식을 지정한 명령어를 사용한다.)
+*/
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define Y_MATRIX_X86_SIMD 1
+#else
+#define Y_MATRIX_X86_SIMD 0
+#endif
+
+// 한 번에 계산하는 선로의 수
+const unsigned long long int BRANCH_BLOCK_SIZE = 256;
+
+/* calcAdmittance() 함수
+*
+* 기능: 선로 1개의 직렬 어드미턴스와 대각 성분에 더해지는 허수값을 계산한다. 분모는 한 번만 계산한다.
+* 입력값: R, X, C, G, B, diagB(계산한 값을 저장할 변수)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+inline void calcAdmittance(T R, T X, T C, T& G, T& B, T& diagB)
+{
+    T denominator = R * R + X * X;
+
+    G = R / denominator;
+    B = (-1) * X / denominator;
+    diagB = B + C / 2;
+
+    return;
+}
+
+/* calcAdmittanceScalar() 함수
+*
+* 기능: 여러 선로의 어드미턴스를 SIMD 명령어 없이 차례대로 계산한다.
+* 입력값: count(선로 수), R, X, C(선로 값의 배열), G, B, diagB(계산한 값을 저장할 배열)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+void calcAdmittanceScalar(unsigned long long int count, const T* R, const T* X, const T* C, T* G, T* B, T* diagB)
+{
+    for (unsigned long long int i = 0; i < count; i++)
+    {
+        calcAdmittance(R[i], X[i], C[i], G[i], B[i], diagB[i]);
+    }
+
+    return;
+}
+
+#if Y_MATRIX_X86_SIMD
+__attribute__((target("avx2"))) void calcAdmittanceAVX2(unsigned long long int count, const double* R, const double* X, const double* C, double* G, double* B, double* diagB);
+
+__attribute__((target("avx2"))) void calcAdmittanceAVX2(unsigned long long int count, const float* R, const float* X, const float* C, float* G, float* B, float* diagB);
+
+__attribute__((target("avx512f"))) void calcAdmittanceAVX512(unsigned long long int count, const double* R, const double* X, const double* C, double* G, double* B, double* diagB);
+
+__attribute__((target("avx512f"))) void calcAdmittanceAVX512(unsigned long long int count, const float* R, const float* X, const float* C, float* G, float* B, float* diagB);
+#endif
+
+int admittanceKernel();
+
+const char* admittanceKernelName();
+
+/* calcAdmittanceBatch() 함수
+*
+* 기능: 여러 선로의 직렬 어드미턴스(G + jB)와 대각 성분에 더해지는 허수값(B + C/2)을 한 번에 계산한다.
+*       double과 float는 CPU에 따라 AVX-512, AVX2 명령어를 사용하며, long double은 일반 계산을 한다.
+* 입력값: count(선로 수), R, X, C(선로 값의 배열), G, B, diagB(계산한 값을 저장할 배열)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T>
+void calcAdmittanceBatch(unsigned long long int count, const T* R, const T* X, const T* C, T* G, T* B, T* diagB)
+{
+#if Y_MATRIX_X86_SIMD
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+    {
+        if (admittanceKernel() == 2)
+        {
+            calcAdmittanceAVX512(count, R, X, C, G, B, diagB);
+            return;
+        }else if (admittanceKernel() == 1)
+        {
+            calcAdmittanceAVX2(count, R, X, C, G, B, diagB);
+            return;
+        }
+    }
+#endif
+    calcAdmittanceScalar(count, R, X, C, G, B, diagB);
+
+    return;
+}
+
+/* Y_Matrix 클래스
+* 
+* 기능: 특정 전력계통의 Y_Matrix값을 저장한다.
+*       T는 어드미턴스 값을 저장하고 계산하는 실수 형식(float, double, long double)이며,
+*       IndexT는 node 번호와 저장 위치를 나타내는 부호 있는 정수 형식이다. (모든 node 번호가 IndexT의 범위 안에 있어야 한다.)
+*       0이 아닌 값은 node1, node2, G, jB를 각각의 배열로 나누어 저장한다. (Structure of Arrays)
+*       기본값인 Y_Matrix<long double, long long int>는 기존과 같은 정밀도로 계산하며, 정확도 비교에 사용한다.
+*       Y_Matrix<double, int32_t>의 memory는 Hash Table을 포함하여 기본값의 약 1/2이다. (Hash Table과 배열의 여유 공간은 형식과 관계없이 남는다.)
+*       값은 node1 <= node2인 위치에 저장하며, 위상 변위 변압기로 하삼각 값이 다른 경우에만 그 차이를 (node2, node1)(node2 > node1)에 저장한다.
+* 최종 수정일: 2026/10/17
+*/
+template <typename T = long double, typename IndexT = long long int>
+class Y_Matrix{
+    static_assert(std::is_signed_v<IndexT>, "IndexT must be a signed integer type");
+
+private:
+    // Y-Matrix의 0이 아닌 값을 저장하는 vector(같은 위치의 값이 하나의 값을 이룬다.)
+    std::vector<IndexT> lineNode1, lineNode2;
+    std::vector<T> lineG, lineJB;
+
+    // (node1, node2)를 key로, 값이 저장된 위치를 저장하는 Hash Table(비어있는 칸은 -1)
+    std::vector<IndexT> hashTable;
+
+    // node1 > node2인 값(하삼각 값과 상삼각 값의 차이)이 저장된 적이 있는지 여부
+    bool hasLowerValue;
+
+    static unsigned long long int hashNode(long long int Node1, long long int Node2);
+
+    long long int findSlot(long long int Node1, long long int Node2) const;
+
+    void insertHash(long long int location);
+
+    void rehashMatrix(unsigned long long int tableSize);
+
+    void eraseMatrix(long long int location);
+
+    long long int findMatrix(long long int Node1, long long int Node2) const;
+
+    void pushValue(const Y_Matrix_Val<T, IndexT>& yMatrixVal);
+
+    void addValue(long long int Node1, long long int Node2, T realVal, T imagVal);
+
+
+    bool isValueEmpty(long long int cursor);
+
+    static void calcBranchValue(std::span<const Branch_Val> branch, Y_Matrix_Val<T, IndexT>* yMatrixVal);
+
+    static void reduceMatrix(std::vector<Y_Matrix_Val<T, IndexT>>& entry, bool isDeterministic);
+
+    void storeReducedMatrix(std::vector<Y_Matrix_Val<T, IndexT>>&& entry);
+
+    static void calcTransformer(long double R, long double L, long double C, long double tap, long double shift, std::complex<T> block[2][2]);
+
+    void addBlock(long long int Node1, long long int Node2, const std::complex<T> block[2][2]);
+
+public:
+Y_Matrix();
+~Y_Matrix();
+
+void addMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C);
+
+void subtractMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C);
+
+void addMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C);
+
+void subtractMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C);
+
+void addTransformer(long long int Node1, long long int Node2, long double R, long double L, long double C, long double tap, long double shift);
+
+void subtractTransformer(long long int Node1, long long int Node2, long double R, long double L, long double C, long double tap, long double shift);
+
+void updateTap(long long int Node1, long long int Node2, long double R, long double L, long double C, long double oldTap, long double oldShift, long double newTap, long double newShift);
+
+void addShunt(long long int Node, long double G, long double B);
+
+void subtractShunt(long long int Node, long double G, long double B);
+
+void addDevices(std::span<const Device_Val> device);
+
+void addBranches(std::span<const Branch_Val> branch);
+
+void addMatrixParallel(const std::vector<Branch_Val>& branch, int threadCount, bool isDeterministic);
+
+std::complex<long double> getMatrix(long long int Node1, long long int Node2) const;
+
+void getMatrix(long long int Node1, long long int Node2, long double matrixVal[2]) const;
+
+void getMatrix(std::span<const std::pair<long long int, long long int>> node, std::span<std::complex<long double>> matrixVal) const;
+
+long long int nonzeroCount() const;
+
+unsigned long long int memoryUsage() const;
+
+Y_Matrix_CSR freeze() const;
+
+};
+
+/* Y_Matrix의 생성자
+ *
+ * 기능: 하삼각 값의 저장 여부 초기화
+ * 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+Y_Matrix<T, IndexT>::Y_Matrix()
+{
+    hasLowerValue = false;
+
+    return;
+}
+
+/* Y_Matrix의 소멸자
+* 
+* 기능: 값을 저장한 Vector, hashTable 초기화
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+Y_Matrix<T, IndexT>::~Y_Matrix()
+{
+    // 벡터 초기화
+    lineNode1.clear();
+    lineNode2.clear();
+    lineG.clear();
+    lineJB.clear();
+    hashTable.clear();
+
+    return;
+}
+
+/* Y_Matrix::hashNode() 함수
+*
+* 기능: 두 node의 값을 하나의 64bit Hash 값으로 만든다. (SplitMix64 방식으로 bit를 섞는다.)
+* 입력값: Node1, Node2
+* 출력값: Hash 값
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+unsigned long long int Y_Matrix<T, IndexT>::hashNode(long long int Node1, long long int Node2)
+{
+    unsigned long long int key = (unsigned long long int)Node1 * 0x9E3779B97F4A7C15ULL ^ (unsigned long long int)Node2;
+
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+
+    return key;
+}
+
+/* Y_Matrix::findSlot() 함수
+*
+* 기능: hashTable에서 특정 node의 값이 저장된 칸을, 없는 경우 해당 node의 값이 들어갈 빈 칸을 찾는다. (Linear Probing)
+* 입력값: Node1, Node2
+* 출력값: hashTable에서의 칸의 위치
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+long long int Y_Matrix<T, IndexT>::findSlot(long long int Node1, long long int Node2) const
+{
+    // hashTable의 크기는 항상 2의 거듭제곱이다.
+    unsigned long long int mask = hashTable.size() - 1;
+    unsigned long long int slot = hashNode(Node1, Node2) & mask;
+
+    // 빈 칸 또는 해당 node의 값을 찾을 때까지 다음 칸을 확인한다. (확인한 칸의 수는 끝난 뒤 한 번에 기록한다.)
+    unsigned long long int probeCount = 1;
+    while (hashTable[slot] != -1)
+    {
+        if (lineNode1[hashTable[slot]] == Node1 && lineNode2[hashTable[slot]] == Node2)
+        {
+            break;
+        }
+        slot = (slot + 1) & mask;
+        probeCount++;
+    }
+    STATS_ADD(STAT_PROBE, probeCount);
+
+    return slot;
+}
+
+/* Y_Matrix::insertHash() 함수
+*
+* 기능: 특정 위치의 값을 hashTable에 등록한다. 저장된 값이 hashTable 크기의 절반을 넘는 경우, hashTable의 크기를 늘린다.
+* 입력값: location(값이 저장된 위치)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::insertHash(long long int location)
+{
+    // 사용률이 1/2을 넘는 경우, hashTable의 크기를 2배로 늘린다. (늘리는 과정에서 모든 값이 다시 등록된다.)
+    if (lineG.size() * 2 > hashTable.size())
+    {
+        rehashMatrix(hashTable.size() < 16 ? 16 : hashTable.size() * 2);
+        return;
+    }
+
+    hashTable[findSlot(lineNode1[location], lineNode2[location])] = location;
+
+    return;
+}
+
+/* Y_Matrix::rehashMatrix() 함수
+*
+* 기능: hashTable을 주어진 크기로 다시 만들고, 저장된 모든 값을 다시 등록한다.
+* 입력값: tableSize(2의 거듭제곱)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::rehashMatrix(unsigned long long int tableSize)
+{
+    hashTable.assign(tableSize, -1);
+    STATS_ADD(STAT_REHASH, 1);
+
+    for (unsigned long long int i = 0; i < lineG.size(); i++)
+    {
+        hashTable[findSlot(lineNode1[i], lineNode2[i])] = i;
+    }
+
+    return;
+}
+
+/* Y_Matrix::eraseMatrix() 함수
+*
+* 기능: 특정 위치의 값을 제거한다.
+*       마지막 값을 제거된 위치로 옮겨 뒷부분 전체가 이동하지 않도록 하고, hashTable도 이에 맞게 수정한다.
+* 입력값: location(값이 저장된 위치)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::eraseMatrix(long long int location)
+{
+    unsigned long long int mask = hashTable.size() - 1;
+    unsigned long long int slot = findSlot(lineNode1[location], lineNode2[location]);
+    unsigned long long int next = slot, home;
+    long long int last = (long long int)lineG.size() - 1;
+
+    // 해당 칸을 비우고, 뒤에 이어진 값들 중 빈 칸을 지나야 찾을 수 있게 된 값을 앞으로 당긴다. (Backward Shift Deletion)
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (hashTable[next] == -1)
+        {
+            break;
+        }
+
+        // 해당 값이 원래 들어가야 하는 칸
+        home = hashNode(lineNode1[hashTable[next]], lineNode2[hashTable[next]]) & mask;
+
+        // 원래 칸이 (slot, next] 범위 밖에 있는 경우, 해당 값을 slot으로 옮긴다.
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            hashTable[slot] = hashTable[next];
+            slot = next;
+            STATS_ADD(STAT_ERASE_SHIFT, 1);
+        }
+    }
+    hashTable[slot] = -1;
+    STATS_ADD(STAT_ERASE, 1);
+
+    // 마지막 값을 제거된 위치로 옮기고, hashTable에 저장된 위치를 수정한다.
+    if (location != last)
+    {
+        hashTable[findSlot(lineNode1[last], lineNode2[last])] = location;
+        lineNode1[location] = lineNode1[last];
+        lineNode2[location] = lineNode2[last];
+        lineG[location] = lineG[last];
+        lineJB[location] = lineJB[last];
+    }
+    lineNode1.pop_back();
+    lineNode2.pop_back();
+    lineG.pop_back();
+    lineJB.pop_back();
+
+    return;
+}
+
+/* Y_Matrix::findMatrix() 함수
+* 
+* 기능: 특정 node의 값이 저장된 위치를 찾는다.
+* 입력값: node1, node2
+* 출력값: 해당 node의 값이 저장된 위치(저장되지 않은 경우, -1 반환)
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+long long int Y_Matrix<T, IndexT>::findMatrix(long long int Node1, long long int Node2) const
+{
+    STATS_ADD(STAT_LOOKUP, 1);
+
+    // 저장된 값이 없는 경우, -1 출력
+    if (hashTable.empty())
+    {
+        return -1;
+    }
+
+    // hashTable에서 해당 node의 칸을 찾아, 저장된 위치를 출력한다. (저장되지 않은 경우, 빈 칸의 값인 -1이 출력된다.)
+    return hashTable[findSlot(Node1, Node2)];
+}
+
+/* Y_Matrix::pushValue() 함수
+*
+* 기능: 새로운 값을 마지막 위치에 저장하고, hashTable에 등록한다.
+* 입력값: yMatrixVal(저장할 값)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::pushValue(const Y_Matrix_Val<T, IndexT>& yMatrixVal)
+{
+    lineNode1.push_back(yMatrixVal.node1);
+    lineNode2.push_back(yMatrixVal.node2);
+    lineG.push_back(yMatrixVal.G);
+    lineJB.push_back(yMatrixVal.jB);
+    insertHash(lineG.size() - 1);
+    STATS_ADD(STAT_INSERT, 1);
+
+    return;
+}
+
+/* Y_Matrix::isValueEmpty() 함수
+*
+* 기능: 특정 위치의 값이 0인지 확인한다.
+* 입력값: cursor
+* 출력값: 특정 위치의 어드미턴스 값이 0인 경우 참을, 그렇지 않은 경우 거짓을 반환한다.
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+bool Y_Matrix<T, IndexT>::isValueEmpty(long long int cursor)
+{
+    // 특정 위치의 어드미턴스 값이 0인 경우 참을, 그렇지 않은 경우 거짓을 반환한다.
+    return (lineG[cursor] == 0 && lineJB[cursor] == 0);
+}
+
+/* Y_Matrix::addValue() 함수
+*
+* 기능: Y-Matrix의 특정 위치에 계산이 끝난 어드미턴스 값을 더한다. 더한 값이 0이 된 경우, 해당 값을 제거한다.
+* 입력값: Node1, Node2, realVal, imagVal(더할 어드미턴스의 실수값과 허수값)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addValue(long long int Node1, long long int Node2, T realVal, T imagVal)
+{
+    // 값을 저장하기 위한 yMatrixVal 생성
+    Y_Matrix_Val<T, IndexT> yMatrixVal;
+
+    // 저장할 값의 위치를 찾기
+    long long int location = findMatrix(Node1, Node2);
+
+    // 해당 node가 저장된 위치가 존재하는 경우
+    if (location != -1)
+    {
+        // 계산한 값을 추가한다.
+        lineG[location] += realVal;
+        lineJB[location] += imagVal;
+
+        // 추가된 값이 0이 된 경우, 해당 데이터를 vector에서 지운다.
+        if (isValueEmpty(location))
+        {
+            eraseMatrix(location);
+        }
+    }else{ // 해당 node가 저장된 위치가 존재하지 않는 경우
+        // vector에 해당 값을 추가하기 위해 Y_Matrix_Val 구조체 형식으로 저장한다.
+        yMatrixVal.node1 = Node1;
+        yMatrixVal.node2 = Node2;
+        yMatrixVal.G = realVal;
+        yMatrixVal.jB = imagVal;
+
+        // 해당 값을 vector에 추가하고, hashTable에 등록한다.
+        pushValue(yMatrixVal);
+    }
+
+    return;
+}
+
+/* Y_Matrix::addMatrix() 함수
+* 
+* 기능: Y-Matrix에 특정 값을 추가한다. 입력된 두 node가 같은 경우와 다른 경우를 구분한다.
+* 입력값: Node1, Node2, R, L, C값
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C)
+{
+    // 어드미턴스 값을 미리 계산하기 위한 변수 생성
+    T seriesG, seriesB, diagB;
+
+    calcAdmittance<T>(R, L, C, seriesG, seriesB, diagB);
+
+    // 두 node가 같은 경우와 다른 경우를 구분하여 더한다.
+    if (Node1 == Node2)
+    {
+        addValue(Node1, Node2, seriesG, diagB);
+    }else{
+        addValue(Node1, Node2, -seriesG, -seriesB);
+    }
+
+    return;
+}
+
+/* Y_Matrix::subtractMatrix() 함수
+*
+* 기능: Y-Matrix에 특정 값을 감산한다. 입력된 두 node가 같은 경우와 다른 경우를 구분한다.
+* 입력값: Node1, Node2, R, L, C값
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::subtractMatrix(long long int Node1, long long int Node2, long double R, long double L, long double C)
+{
+    // 어드미턴스 값을 미리 계산하기 위한 변수 생성
+    T seriesG, seriesB, diagB;
+
+    calcAdmittance<T>(R, L, C, seriesG, seriesB, diagB);
+
+    // 두 node가 같은 경우와 다른 경우를 구분하여, 부호를 바꾸어 더한다.
+    if (Node1 == Node2)
+    {
+        addValue(Node1, Node2, -seriesG, -diagB);
+    }else{
+        addValue(Node1, Node2, seriesG, seriesB);
+    }
+
+    return;
+}
+
+/* Y_Matrix::addMatrixPackage() 함수
+*
+* 기능: Y-Matrix에 특정 node의 값을 추가하도록 한다. 선로의 어드미턴스는 한 번만 계산하여 3개의 위치에 더한다.
+* 입력값: Node1, Node2, R, L, C값
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C)
+{
+    T seriesG, seriesB, diagB;
+
+    // node1 > node2인 경우, 두 값을 서로 바꾼다.
+    if (Node1 > Node2)
+    {
+        std::swap(Node1, Node2);
+    }
+
+    calcAdmittance<T>(R, L, C, seriesG, seriesB, diagB);
+
+    // node1 추가
+    addValue(Node1, Node1, seriesG, diagB);
+    // node2 추가
+    addValue(Node2, Node2, seriesG, diagB);
+    // node1 - node2 추가(두 node가 같은 경우, 대각 성분의 값을 더한다.)
+    if (Node1 == Node2)
+    {
+        addValue(Node1, Node2, seriesG, diagB);
+    }else{
+        addValue(Node1, Node2, -seriesG, -seriesB);
+    }
+
+    return;
+}
+
+/* Y_Matrix::subtractMatrixPackage() 함수
+*
+* 기능: Y-Matrix에 특정 node의 값을 감산하도록 한다. 선로의 어드미턴스는 한 번만 계산하여 3개의 위치에서 뺀다.
+* 입력값: Node1, Node2, R, L, C값
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::subtractMatrixPackage(long long int Node1, long long int Node2, long double R, long double L, long double C)
+{
+    T seriesG, seriesB, diagB;
+
+    // node1 > node2인 경우, 두 값을 서로 바꾼다.
+    if (Node1 > Node2)
+    {
+        std::swap(Node1, Node2);
+    }
+
+    calcAdmittance<T>(R, L, C, seriesG, seriesB, diagB);
+
+    // node1 감산
+    addValue(Node1, Node1, -seriesG, -diagB);
+    // node2 감산
+    addValue(Node2, Node2, -seriesG, -diagB);
+    // node1 - node2 감산(두 node가 같은 경우, 대각 성분의 값을 뺀다.)
+    if (Node1 == Node2)
+    {
+        addValue(Node1, Node2, -seriesG, -diagB);
+    }else{
+        addValue(Node1, Node2, seriesG, seriesB);
+    }
+
+    return;
+}
+
+/* Y_Matrix::calcTransformer() 함수
+*
+* 기능: tap 비와 위상 변위를 가진 변압기(π 모델)가 두 node 사이에 더하는 2x2 어드미턴스 값을 구한다.
+*       tap 쪽(node1)에 a = tap * e^(j shift)의 이상 변압기가 있으며, y = 1 / (R + jX), y_c = jC / 2일 때
+*       Y11 = (y + y_c) / tap^2, Y22 = y + y_c, Y12 = -y / conj(a), Y21 = -y / a 이다. (위상 변위가 있는 경우 Y12와 Y21이 다르다.)
+*       tap = 1, shift = 0인 경우 addMatrixPackage()와 같은 값이 된다.
+* 입력값: R, L(리액턴스), C, tap, shift(도), block(값을 저장할 공간, [0]은 node1, [1]은 node2)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::calcTransformer(long double R, long double L, long double C, long double tap, long double shift, std::complex<T> block[2][2])
+{
+    T seriesG, seriesB, diagB;
+    long double angle = shift * 3.14159265358979323846L / 180;
+    std::complex<T> rotation((T)std::cos(angle), (T)std::sin(angle)); // e^(j shift)
+
+    calcAdmittance<T>(R, L, C, seriesG, seriesB, diagB);
+
+    std::complex<T> seriesY(seriesG, seriesB);
+    block[0][0] = std::complex<T>(seriesG, diagB) / (T)(tap * tap);
+    block[1][1] = std::complex<T>(seriesG, diagB);
+    block[0][1] = -seriesY * rotation / (T)tap;
+    block[1][0] = -seriesY * std::conj(rotation) / (T)tap;
+
+    return;
+}
+
+/* Y_Matrix::addBlock() 함수
+*
+* 기능: 두 node 사이의 2x2 어드미턴스 값을 최대 4개의 위치에 더한다.
+*       상삼각 값은 (node1, node2)(node1 < node2)에 저장하고, 하삼각 값이 상삼각 값과 다른 경우 그 차이만 (node2, node1)에 저장한다.
+* 입력값: Node1, Node2, block(더할 값, [0]은 Node1, [1]은 Node2)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addBlock(long long int Node1, long long int Node2, const std::complex<T> block[2][2])
+{
+    // 두 node가 같은 경우, 모든 값을 대각 성분에 더한다.
+    if (Node1 == Node2)
+    {
+        std::complex<T> value = block[0][0] + block[1][1] + block[0][1] + block[1][0];
+        addValue(Node1, Node1, value.real(), value.imag());
+        return;
+    }
+
+    std::complex<T> upperVal = Node1 < Node2 ? block[0][1] : block[1][0];
+    std::complex<T> lowerVal = Node1 < Node2 ? block[1][0] : block[0][1];
+    std::complex<T> difference = lowerVal - upperVal;
+
+    // node1 추가
+    addValue(Node1, Node1, block[0][0].real(), block[0][0].imag());
+    // node2 추가
+    addValue(Node2, Node2, block[1][1].real(), block[1][1].imag());
+    // 상삼각 값 추가
+    addValue(std::min(Node1, Node2), std::max(Node1, Node2), upperVal.real(), upperVal.imag());
+    // 하삼각 값이 다른 경우, 차이 추가
+    if (difference != std::complex<T>(0))
+    {
+        addValue(std::max(Node1, Node2), std::min(Node1, Node2), difference.real(), difference.imag());
+        hasLowerValue = true;
+    }
+
+    return;
+}
+
+/* Y_Matrix::addTransformer() 함수
+*
+* 기능: Y-Matrix에 tap 비와 위상 변위를 가진 변압기를 추가한다. (tap 쪽은 Node1)
+* 입력값: Node1, Node2, R, L, C, tap, shift(도)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addTransformer(long long int Node1, long long int Node2, long double R, long double L, long double C, long double tap, long double shift)
+{
+    std::complex<T> block[2][2];
+
+    calcTransformer(R, L, C, tap, shift, block);
+    addBlock(Node1, Node2, block);
+
+    return;
+}
+
+/* Y_Matrix::subtractTransformer() 함수
+*
+* 기능: Y-Matrix에서 tap 비와 위상 변위를 가진 변압기를 제거한다. (tap 쪽은 Node1)
+* 입력값: Node1, Node2, R, L, C, tap, shift(도)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::subtractTransformer(long long int Node1, long long int Node2, long double R, long double L, long double C, long double tap, long double shift)
+{
+    std::complex<T> block[2][2];
+
+    calcTransformer(R, L, C, tap, shift, block);
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            block[i][j] = -block[i][j];
+        }
+    }
+    addBlock(Node1, Node2, block);
+
+    return;
+}
+
+/* Y_Matrix::updateTap() 함수
+*
+* 기능: 이미 추가된 변압기의 tap 비와 위상 변위를 바꾼다.
+*       바뀌기 전후의 2x2 값의 차이만을 구해 해당 변압기의 4개의 위치에 더하며, 다른 값은 다시 계산하지 않는다.
+* 입력값: Node1, Node2, R, L, C, oldTap, oldShift(바뀌기 전 값), newTap, newShift(바뀐 후 값)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::updateTap(long long int Node1, long long int Node2, long double R, long double L, long double C, long double oldTap, long double oldShift, long double newTap, long double newShift)
+{
+    std::complex<T> oldBlock[2][2], block[2][2];
+
+    calcTransformer(R, L, C, oldTap, oldShift, oldBlock);
+    calcTransformer(R, L, C, newTap, newShift, block);
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            block[i][j] -= oldBlock[i][j];
+        }
+    }
+    addBlock(Node1, Node2, block);
+
+    return;
+}
+
+/* Y_Matrix::addShunt() 함수
+*
+* 기능: Y-Matrix에 병렬 소자(병렬 Capacitor, Reactor 등)를 추가한다. 어드미턴스를 대각 성분에 바로 더한다.
+* 입력값: Node, G, B(병렬 소자의 어드미턴스)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addShunt(long long int Node, long double G, long double B)
+{
+    addValue(Node, Node, (T)G, (T)B);
+
+    return;
+}
+
+/* Y_Matrix::subtractShunt() 함수
+*
+* 기능: Y-Matrix에서 병렬 소자를 제거한다.
+* 입력값: Node, G, B(병렬 소자의 어드미턴스)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::subtractShunt(long long int Node, long double G, long double B)
+{
+    addValue(Node, Node, -(T)G, -(T)B);
+
+    return;
+}
+
+/* Y_Matrix::addDevices() 함수
+*
+* 기능: 입력 파일에서 읽은 변압기와 병렬 소자를 차례대로 Y-Matrix에 추가한다.
+* 입력값: device(추가할 소자)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addDevices(std::span<const Device_Val> device)
+{
+    for (const Device_Val& deviceVal : device)
+    {
+        if (deviceVal.type == DEVICE_TRANSFORMER)
+        {
+            addTransformer(deviceVal.node1, deviceVal.node2, deviceVal.R, deviceVal.L, deviceVal.C, deviceVal.tap, deviceVal.shift);
+        }else{
+            addShunt(deviceVal.node1, deviceVal.G, deviceVal.B);
+        }
+    }
+
+    return;
+}
+
+/* Y_Matrix::calcBranchValue() 함수
+*
+* 기능: 여러 선로가 Y-Matrix에 더하는 값을, 선로마다 addMatrixPackage()와 같은 순서(node1, node2, node1 - node2)로 3개씩 계산한다.
+*       BRANCH_BLOCK_SIZE개의 선로씩 R, X, C를 배열로 모아 calcAdmittanceBatch()로 어드미턴스를 한 번에 계산한다.
+* 입력값: branch(선로 정보), yMatrixVal(계산한 값을 저장할 배열, 길이는 선로 수의 3배)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::calcBranchValue(std::span<const Branch_Val> branch, Y_Matrix_Val<T, IndexT>* yMatrixVal)
+{
+    T R[BRANCH_BLOCK_SIZE], X[BRANCH_BLOCK_SIZE], C[BRANCH_BLOCK_SIZE];
+    T seriesG[BRANCH_BLOCK_SIZE], seriesB[BRANCH_BLOCK_SIZE], diagB[BRANCH_BLOCK_SIZE];
+
+    for (unsigned long long int first = 0; first < branch.size(); first += BRANCH_BLOCK_SIZE)
+    {
+        unsigned long long int count = std::min<unsigned long long int>(BRANCH_BLOCK_SIZE, branch.size() - first);
+
+        // 선로 값을 배열로 모아 어드미턴스를 계산한다.
+        for (unsigned long long int i = 0; i < count; i++)
+        {
+            R[i] = branch[first + i].R;
+            X[i] = branch[first + i].L;
+            C[i] = branch[first + i].C;
+        }
+        calcAdmittanceBatch(count, R, X, C, seriesG, seriesB, diagB);
+
+        // 계산한 값을 3개의 위치에 나누어 저장한다.
+        for (unsigned long long int i = 0; i < count; i++)
+        {
+            long long int Node1 = branch[first + i].node1, Node2 = branch[first + i].node2;
+            Y_Matrix_Val<T, IndexT>* value = yMatrixVal + (first + i) * 3;
+
+            // node1 > node2인 경우, 두 값을 서로 바꾼다.
+            if (Node1 > Node2)
+            {
+                std::swap(Node1, Node2);
+            }
+
+            value[0] = { (IndexT)Node1, (IndexT)Node1, seriesG[i], diagB[i] };
+            value[1] = { (IndexT)Node2, (IndexT)Node2, seriesG[i], diagB[i] };
+            if (Node1 == Node2)
+            {
+                value[2] = { (IndexT)Node1, (IndexT)Node2, seriesG[i], diagB[i] };
+            }else{
+                value[2] = { (IndexT)Node1, (IndexT)Node2, -seriesG[i], -seriesB[i] };
+            }
+        }
+    }
+
+    return;
+}
+
+/* Y_Matrix::reduceMatrix() 함수
+*
+* 기능: 같은 node의 값이 여러 개 들어있는 entry vector를 정렬하여, 같은 node의 값을 하나로 합치고 0이 된 값을 제거한다.
+*       addMatrix() 함수를 차례대로 호출한 것과 같은 결과가 되도록, 합이 0이 된 뒤에 더해지는 값은 새로 저장한 것과 같이 처리한다.
+* 입력값: entry(합칠 값, 결과도 이곳에 저장한다), isDeterministic(참인 경우, 같은 node의 값은 entry에 들어있던 순서대로 더한다.)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::reduceMatrix(std::vector<Y_Matrix_Val<T, IndexT>>& entry, bool isDeterministic)
+{
+    auto compareNode = [](const Y_Matrix_Val<T, IndexT>& a, const Y_Matrix_Val<T, IndexT>& b) {
+        return a.node1 != b.node1 ? a.node1 < b.node1 : a.node2 < b.node2;
+    };
+
+    // (node1, node2) 순서로 정렬한다. 더하는 순서가 결과에 영향을 주므로, 같은 결과가 필요한 경우 stable_sort를 사용한다.
+    if (isDeterministic)
+    {
+        std::stable_sort(entry.begin(), entry.end(), compareNode);
+    }else{
+        std::sort(entry.begin(), entry.end(), compareNode);
+    }
+
+    // 같은 node의 값을 합치고, 0이 아닌 값만을 앞쪽으로 모은다.
+    unsigned long long int length = 0;
+    for (unsigned long long int i = 0; i < entry.size(); )
+    {
+        Y_Matrix_Val<T, IndexT> sumVal = entry[i];
+
+        for (i++; i < entry.size() && entry[i].node1 == sumVal.node1 && entry[i].node2 == sumVal.node2; i++)
+        {
+            // 합이 0이 된 경우, addMatrix()에서는 값을 지운 뒤 새로 저장하므로 이와 같이 처리한다.
+            if (sumVal.G == 0 && sumVal.jB == 0)
+            {
+                sumVal.G = entry[i].G;
+                sumVal.jB = entry[i].jB;
+            }else{
+                sumVal.G += entry[i].G;
+                sumVal.jB += entry[i].jB;
+            }
+        }
+
+        if (sumVal.G != 0 || sumVal.jB != 0)
+        {
+            entry[length++] = sumVal;
+        }
+    }
+    entry.resize(length);
+
+    return;
+}
+
+/* Y_Matrix::addMatrixParallel() 함수
+*
+* 기능: 여러 선로의 값을 여러 thread로 나누어 Y-Matrix에 추가한다.
+*       각 thread는 맡은 선로의 어드미턴스 값을 계산해 (node1, node2)의 Hash 값에 따라 나눈 thread별 buffer에 저장하고,
+*       이후 각 thread가 자신이 맡은 Hash 구간의 값을 모아 정렬, 합산한다.
+*       isDeterministic이 참인 경우, 선로 순서대로 더하므로 addMatrixPackage()를 차례대로 호출한 결과와 bit 단위로 같다.
+* 입력값: branch(추가할 선로), threadCount(사용할 thread 수), isDeterministic
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addMatrixParallel(const std::vector<Branch_Val>& branch, int threadCount, bool isDeterministic)
+{
+    if (threadCount < 1)
+    {
+        threadCount = 1;
+    }
+
+    // localValue[t][p]: thread t가 계산한 값 중 thread p가 합칠 값
+    std::vector<std::vector<std::vector<Y_Matrix_Val<T, IndexT>>>> localValue(threadCount, std::vector<std::vector<Y_Matrix_Val<T, IndexT>>>(threadCount));
+    std::vector<std::vector<Y_Matrix_Val<T, IndexT>>> reducedValue(threadCount);
+    std::vector<std::thread> worker;
+
+    // 1단계: 선로를 thread 수만큼 연속된 구간으로 나누어, 각 선로의 어드미턴스 값을 계산한다.
+    for (int t = 0; t < threadCount; t++)
+    {
+        worker.emplace_back([&, t]() {
+            unsigned long long int first = branch.size() * t / threadCount, last = branch.size() * (t + 1) / threadCount;
+            std::vector<Y_Matrix_Val<T, IndexT>> yMatrixVal(BRANCH_BLOCK_SIZE * 3);
+
+            for (unsigned long long int i = first; i < last; i += BRANCH_BLOCK_SIZE)
+            {
+                unsigned long long int count = std::min<unsigned long long int>(BRANCH_BLOCK_SIZE, last - i);
+
+                calcBranchValue(std::span<const Branch_Val>(branch).subspan(i, count), yMatrixVal.data());
+                for (unsigned long long int k = 0; k < count * 3; k++)
+                {
+                    localValue[t][hashNode(yMatrixVal[k].node1, yMatrixVal[k].node2) % threadCount].push_back(yMatrixVal[k]);
+                }
+            }
+        });
+    }
+    for (int t = 0; t < threadCount; t++)
+    {
+        worker[t].join();
+    }
+    worker.clear();
+
+    // 2단계: 각 thread가 자신이 맡은 Hash 구간의 값을 기존 값, 선로 순서대로 모아 정렬, 합산한다.
+    for (int p = 0; p < threadCount; p++)
+    {
+        worker.emplace_back([&, p]() {
+            unsigned long long int length = 0;
+
+            for (unsigned long long int i = 0; i < lineG.size(); i++)
+            {
+                if (hashNode(lineNode1[i], lineNode2[i]) % threadCount == (unsigned long long int)p)
+                {
+                    length++;
+                }
+            }
+            for (int t = 0; t < threadCount; t++)
+            {
+                length += localValue[t][p].size();
+            }
+            reducedValue[p].reserve(length);
+
+            // 기존에 저장된 값
+            for (unsigned long long int i = 0; i < lineG.size(); i++)
+            {
+                if (hashNode(lineNode1[i], lineNode2[i]) % threadCount == (unsigned long long int)p)
+                {
+                    reducedValue[p].push_back({ lineNode1[i], lineNode2[i], lineG[i], lineJB[i] });
+                }
+            }
+            // 각 thread가 계산한 값(thread 순서가 선로 순서이다.)
+            for (int t = 0; t < threadCount; t++)
+            {
+                reducedValue[p].insert(reducedValue[p].end(), localValue[t][p].begin(), localValue[t][p].end());
+                std::vector<Y_Matrix_Val<T, IndexT>>().swap(localValue[t][p]);
+            }
+
+            reduceMatrix(reducedValue[p], isDeterministic);
+        });
+    }
+    for (int p = 0; p < threadCount; p++)
+    {
+        worker[p].join();
+    }
+
+    // 3단계: 합친 값을 하나로 모아 저장한다.
+    unsigned long long int totalLength = 0;
+    for (int p = 0; p < threadCount; p++)
+    {
+        totalLength += reducedValue[p].size();
+    }
+    std::vector<Y_Matrix_Val<T, IndexT>> entry;
+    entry.reserve(totalLength);
+    for (int p = 0; p < threadCount; p++)
+    {
+        entry.insert(entry.end(), reducedValue[p].begin(), reducedValue[p].end());
+        std::vector<Y_Matrix_Val<T, IndexT>>().swap(reducedValue[p]);
+    }
+    storeReducedMatrix(std::move(entry));
+
+    return;
+}
+
+/* Y_Matrix::storeReducedMatrix() 함수
+*
+* 기능: 합산이 끝난 값들로 저장된 값을 바꾸고, 이에 맞는 크기의 hashTable을 한 번에 다시 만든다.
+* 입력값: entry(node마다 하나씩인, 0이 아닌 값)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::storeReducedMatrix(std::vector<Y_Matrix_Val<T, IndexT>>&& entry)
+{
+    unsigned long long int tableSize = 16;
+
+    // 각 값을 node1, node2, G, jB 배열로 나누어 저장한다.
+    lineNode1.resize(entry.size());
+    lineNode2.resize(entry.size());
+    lineG.resize(entry.size());
+    lineJB.resize(entry.size());
+    for (unsigned long long int i = 0; i < entry.size(); i++)
+    {
+        lineNode1[i] = entry[i].node1;
+        lineNode2[i] = entry[i].node2;
+        lineG[i] = entry[i].G;
+        lineJB[i] = entry[i].jB;
+    }
+    std::vector<Y_Matrix_Val<T, IndexT>>().swap(entry);
+    STATS_ADD(STAT_INSERT, lineG.size());
+
+    while (tableSize < lineG.size() * 2)
+    {
+        tableSize *= 2;
+    }
+    rehashMatrix(tableSize);
+
+    return;
+}
+
+/* Y_Matrix::addBranches() 함수
+*
+* 기능: 여러 선로의 값을 한 번에 Y-Matrix에 추가한다.
+*       각 선로의 값을 검색 없이 뒤에 이어 붙인 뒤, 한 번의 정렬과 합산으로 같은 node의 값을 합치고, 0이 된 값은 한 번에 제거한다.
+*       선로 순서대로 더하므로, addMatrixPackage()를 차례대로 호출한 결과와 같다.
+* 입력값: branch(추가할 선로)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::addBranches(std::span<const Branch_Val> branch)
+{
+    std::vector<Y_Matrix_Val<T, IndexT>> entry;
+    unsigned long long int storedCount = lineG.size();
+
+    // 기존에 저장된 값 뒤에 각 선로의 값을 이어 붙인다.
+    entry.resize(storedCount + branch.size() * 3);
+    for (unsigned long long int i = 0; i < storedCount; i++)
+    {
+        entry[i] = { lineNode1[i], lineNode2[i], lineG[i], lineJB[i] };
+    }
+    calcBranchValue(branch, &entry[storedCount]);
+
+    // 정렬 후 같은 node의 값을 합치고, 0이 된 값을 제거한다.
+    reduceMatrix(entry, true);
+    storeReducedMatrix(std::move(entry));
+
+    return;
+}
+
+/* Y_Matrix::getMatrix() 함수
+*
+* 기능: Y-Matrix에서 특정 node의 값을 읽어온다.
+*       값을 수정하지 않으므로, 값을 추가, 감산하는 중이 아니라면 여러 thread에서 동시에 호출할 수 있다.
+* 입력값: Node1, Node2
+* 출력값: 해당 node의 어드미턴스(실수값 G, 허수값 jB)
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+std::complex<long double> Y_Matrix<T, IndexT>::getMatrix(long long int Node1, long long int Node2) const
+{
+    // 내부 변수 선언
+    long long int location; // 원하는 값이 저장된 위치를 나타내는 변수
+    long long int lowerLocation = -1; // 하삼각 값과 상삼각 값의 차이가 저장된 위치를 나타내는 변수
+    std::complex<long double> value = 0;
+
+    // node1 > node2인 경우, 두 값을 서로 바꾼다. (위상 변위 변압기가 있는 경우, 하삼각 값과 상삼각 값의 차이를 찾는다.)
+    if (Node1 > Node2)
+    {
+        if (hasLowerValue)
+        {
+            lowerLocation = findMatrix(Node1, Node2);
+        }
+        std::swap(Node1, Node2);
+    }
+
+    // 입력받은 두 node의 값을 가지고 있는 위치를 찾는다.
+    location = findMatrix(Node1, Node2);
+
+    // 두 node의 값이 저장되어 있는 경우, 해당 값을 읽는다. (저장되어 있지 않은 경우, 0)
+    if (location != -1)
+    {  
+        value = std::complex<long double>(lineG[location], lineJB[location]);
+    }
+
+    // 차이가 저장되어 있는 경우, 더한다.
+    if (lowerLocation != -1)
+    {
+        value += std::complex<long double>(lineG[lowerLocation], lineJB[lowerLocation]);
+    }
+
+    return value;
+}
+
+/* Y_Matrix::getMatrix() 함수
+*
+* 기능: Y-Matrix에서 특정 node의 값을 읽어, 주어진 공간에 저장한다.
+* 입력값: Node1, Node2, matrixVal(어드미턴스의 실수값과 허수값을 저장할 공간)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::getMatrix(long long int Node1, long long int Node2, long double matrixVal[2]) const
+{
+    std::complex<long double> value = getMatrix(Node1, Node2);
+
+    matrixVal[0] = value.real();
+    matrixVal[1] = value.imag();
+
+    return;
+}
+
+/* Y_Matrix::getMatrix() 함수
+*
+* 기능: Y-Matrix에서 여러 node의 값을 한 번에 읽어, 주어진 공간에 차례대로 저장한다.
+* 입력값: node((Node1, Node2)의 목록), matrixVal(어드미턴스를 저장할 공간, node와 길이가 같아야 한다.)
+* 출력값 없음
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+void Y_Matrix<T, IndexT>::getMatrix(std::span<const std::pair<long long int, long long int>> node, std::span<std::complex<long double>> matrixVal) const
+{
+    for (unsigned long long int i = 0; i < node.size(); i++)
+    {
+        matrixVal[i] = getMatrix(node[i].first, node[i].second);
+    }
+
+    return;
+}
+
+/* Y_Matrix::nonzeroCount() 함수
+*
+* 기능: 저장된 0이 아닌 값의 수(상삼각 부분, 대각 성분, 하삼각 값과의 차이 포함)를 읽는다.
+* 입력값 없음
+* 출력값: 값의 수
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+long long int Y_Matrix<T, IndexT>::nonzeroCount() const
+{
+    return lineG.size();
+}
+
+/* Y_Matrix::memoryUsage() 함수
+*
+* 기능: 값과 hashTable을 저장하는 데 사용 중인 메모리의 크기를 구한다. (할당된 전체 크기 기준)
+* 입력값 없음
+* 출력값: Byte 단위의 크기
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+unsigned long long int Y_Matrix<T, IndexT>::memoryUsage() const
+{
+    return (lineNode1.capacity() + lineNode2.capacity() + hashTable.capacity()) * sizeof(IndexT) + (lineG.capacity() + lineJB.capacity()) * sizeof(T);
+}
+
+/* buildCSR() 함수
+*
+* 기능: node1 <= node2인 값을 가진 entry를 한 번 정렬하여, 상삼각, 하삼각 부분을 모두 가진 CSR 형태의 Y-Matrix를 만든다. (값은 long double로 바꾸어 저장한다.)
+*       node1 > node2인 값은 하삼각 값과 상삼각 값의 차이로 보고, 상삼각 값의 node를 뒤바꾼 값에 더한다. (구조는 항상 대칭이다.)
+* 입력값: entry(각 위치에 하나씩 있는 값, 대각 성분이 아닌 상삼각 값은 node를 뒤바꾼 값이 뒤에 추가된다.)
+* 출력값: CSR 형태의 Y-Matrix
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+Y_Matrix_CSR buildCSR(std::vector<Y_Matrix_Val<T, IndexT>>& entry)
+{
+    Y_Matrix_CSR matrixCSR;
+
+    // 대각 성분이 아닌 상삼각 값은 node를 뒤바꾼 값도 추가한다.
+    unsigned long long int upperCount = entry.size();
+    bool hasLowerValue = false;
+    for (unsigned long long int i = 0; i < upperCount; i++)
+    {
+        if (entry[i].node1 < entry[i].node2)
+        {
+            entry.push_back({ entry[i].node2, entry[i].node1, entry[i].G, entry[i].jB });
+        }else if (entry[i].node1 > entry[i].node2)
+        {
+            // 상삼각 값이 0이 되어 제거된 경우에도 구조가 대칭이 되도록, 상삼각 위치에 0을 더한다.
+            entry.push_back({ entry[i].node2, entry[i].node1, 0, 0 });
+            hasLowerValue = true;
+        }
+    }
+
+    // (node1, node2) 순서로 정렬한다.
+    std::sort(entry.begin(), entry.end(), [](const Y_Matrix_Val<T, IndexT>& a, const Y_Matrix_Val<T, IndexT>& b) {
+        return a.node1 != b.node1 ? a.node1 < b.node1 : a.node2 < b.node2;
+    });
+
+    // 하삼각 값과 상삼각 값의 차이가 있는 경우, 같은 위치의 두 값을 합친다. (합이 0이 되어도 구조를 대칭으로 유지하기 위해 남긴다.)
+    if (hasLowerValue)
+    {
+        unsigned long long int reducedCount = 0;
+        for (unsigned long long int i = 0; i < entry.size(); i++)
+        {
+            if (reducedCount > 0 && entry[i].node1 == entry[reducedCount - 1].node1 && entry[i].node2 == entry[reducedCount - 1].node2)
+            {
+                entry[reducedCount - 1].G += entry[i].G;
+                entry[reducedCount - 1].jB += entry[i].jB;
+            }else{
+                entry[reducedCount++] = entry[i];
+            }
+        }
+        entry.resize(reducedCount);
+    }
+
+    // 각 행의 node 번호와 시작 위치를 기록한다.
+    for (unsigned long long int i = 0; i < entry.size(); i++)
+    {
+        if (i == 0 || entry[i].node1 != entry[i - 1].node1)
+        {
+            matrixCSR.nodeNum.push_back(entry[i].node1);
+            matrixCSR.rowPtr.push_back(i);
+        }
+    }
+    matrixCSR.rowPtr.push_back(entry.size());
+
+    // 열 위치와 어드미턴스 값을 기록한다.
+    matrixCSR.colIdx.resize(entry.size());
+    matrixCSR.G.resize(entry.size());
+    matrixCSR.jB.resize(entry.size());
+    for (unsigned long long int i = 0; i < entry.size(); i++)
+    {
+        matrixCSR.colIdx[i] = matrixCSR.findRow(entry[i].node2);
+        matrixCSR.G[i] = entry[i].G;
+        matrixCSR.jB[i] = entry[i].jB;
+    }
+
+    return matrixCSR;
+}
+
+/* Y_Matrix::freeze() 함수
+*
+* 기능: 저장된 값을 한 번 정렬하여, 상삼각, 하삼각 부분을 모두 가진 CSR 형태의 Y-Matrix를 만든다. (값은 long double로 바꾸어 저장한다.)
+* 입력값 없음
+* 출력값: CSR 형태의 Y-Matrix
+* 최종 수정일: 2026/10/17
+*/
+template <typename T, typename IndexT>
+Y_Matrix_CSR Y_Matrix<T, IndexT>::freeze() const
+{
+    std::vector<Y_Matrix_Val<T, IndexT>> entry;
+
+    // 저장된 값은 node1 <= node2(node1 > node2는 하삼각 값과의 차이)이며, 대각 성분이 아닌 값의 뒤바꾼 값은 buildCSR()에서 추가한다.
+    entry.reserve(lineG.size() * 2);
+    for (unsigned long long int i = 0; i < lineG.size(); i++)
+    {
+        entry.push_back({ lineNode1[i], lineNode2[i], lineG[i], lineJB[i] });
+    }
+
+    return buildCSR(entry);
+}
+
+#endif // Y_MATRIX_Y_MATRIX_HPP